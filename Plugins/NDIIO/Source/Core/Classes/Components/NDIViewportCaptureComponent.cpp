@@ -15,11 +15,200 @@
 #include <RenderResource.h>
 #include <UnrealClient.h>
 #include <Engine/Engine.h>
+#include <Engine/GameViewportClient.h>
 #include <EngineUtils.h>
 #include <Runtime/Renderer/Private/ScenePrivate.h>
+#include <RenderGraphUtils.h>
+#include <RenderTargetPool.h>
+#if (ENGINE_MAJOR_VERSION > 5) || ((ENGINE_MAJOR_VERSION == 5) && (ENGINE_MINOR_VERSION >= 4))
+#include <PostProcess/PostProcessMaterialInputs.h>
+#else
+#include <Runtime/Renderer/Private/PostProcess/PostProcessMaterial.h>
+#endif
 #include <Misc/CoreDelegates.h>
 
 
+DECLARE_GPU_STAT_NAMED(NDIViewportTap, TEXT("NDI Viewport Tap"));
+
+/**
+	A scene view extension which copies the colour of the game viewport at a stage of its rendering, for a sender
+	to convert and send, instead of rendering the scene again. The copy shows as 'NDI Viewport Tap' in 'stat gpu'.
+*/
+class FNDIViewportTapExtension : public FSceneViewExtensionBase
+{
+public:
+	FNDIViewportTapExtension(const FAutoRegister& AutoRegister, UNDIViewportCaptureComponent* InOwner,
+							 UNDIMediaSender* InSender, ENDIViewportCaptureMode InCaptureMode)
+		: FSceneViewExtensionBase(AutoRegister)
+		, Owner(InOwner)
+		, Sender(InSender)
+		, CaptureMode(InCaptureMode)
+	{}
+
+	/**
+		Stops sending the frames of the viewport, for the frames still being rendered
+	*/
+	void Stop()
+	{
+		FScopeLock Lock(&TapSyncContext);
+
+		this->Sender = nullptr;
+	}
+
+	virtual void SetupViewFamily(FSceneViewFamily& InViewFamily) override {}
+	virtual void SetupView(FSceneViewFamily& InViewFamily, FSceneView& InView) override {}
+	virtual void BeginRenderViewFamily(FSceneViewFamily& InViewFamily) override {}
+
+#if ENGINE_MAJOR_VERSION >= 5
+	virtual void PostRenderViewFamily_RenderThread(FRDGBuilder& GraphBuilder, FSceneViewFamily& InViewFamily) override
+	{
+		if (CaptureMode == ENDIViewportCaptureMode::ViewportFinalColor)
+			TapViewFamily(GraphBuilder, InViewFamily);
+	}
+#elif ENGINE_MAJOR_VERSION == 4
+	virtual void PreRenderViewFamily_RenderThread(FRHICommandListImmediate& RHICmdList, FSceneViewFamily& InViewFamily) override {}
+	virtual void PreRenderView_RenderThread(FRHICommandListImmediate& RHICmdList, FSceneView& InView) override {}
+
+	virtual void PostRenderViewFamily_RenderThread(FRHICommandListImmediate& RHICmdList, FSceneViewFamily& InViewFamily) override
+	{
+		if (CaptureMode == ENDIViewportCaptureMode::ViewportFinalColor)
+		{
+			FRDGBuilder GraphBuilder(RHICmdList);
+			TapViewFamily(GraphBuilder, InViewFamily);
+			GraphBuilder.Execute();
+		}
+	}
+#else
+	#error "Unsupported engine major version"
+#endif
+
+#if (ENGINE_MAJOR_VERSION > 5) || ((ENGINE_MAJOR_VERSION == 5) && (ENGINE_MINOR_VERSION >= 5))
+	virtual void SubscribeToPostProcessingPass(EPostProcessingPass Pass, const FSceneView& InView, FAfterPassCallbackDelegateArray& InOutPassCallbacks, bool bIsPassEnabled) override
+#else
+	virtual void SubscribeToPostProcessingPass(EPostProcessingPass Pass, FAfterPassCallbackDelegateArray& InOutPassCallbacks, bool bIsPassEnabled) override
+#endif
+	{
+		bool bIsTappedPass = ((CaptureMode == ENDIViewportCaptureMode::ViewportAfterMotionBlur) && (Pass == EPostProcessingPass::MotionBlur)) ||
+							 ((CaptureMode == ENDIViewportCaptureMode::ViewportAfterTonemap) && (Pass == EPostProcessingPass::Tonemap)) ||
+							 ((CaptureMode == ENDIViewportCaptureMode::ViewportAfterFXAA) && (Pass == EPostProcessingPass::FXAA));
+
+		if (bIsTappedPass && bIsPassEnabled)
+		{
+			InOutPassCallbacks.Add(FAfterPassCallbackDelegate::CreateRaw(this, &FNDIViewportTapExtension::TapPostProcessingPass));
+		}
+	}
+
+protected:
+	virtual bool IsActiveThisFrame_Internal(const FSceneViewExtensionContext& Context) const override
+	{
+		// Only the view family of the game viewport of the world of the component is tapped
+		UNDIViewportCaptureComponent* Component = Owner.Get();
+		if ((Component == nullptr) || (Context.Viewport == nullptr))
+			return false;
+
+		UWorld* World = Component->GetWorld();
+		UGameViewportClient* GameViewport = (World != nullptr) ? World->GetGameViewport() : nullptr;
+
+		return (GameViewport != nullptr) && (GameViewport->Viewport == Context.Viewport);
+	}
+
+private:
+	void TapViewFamily(FRDGBuilder& GraphBuilder, const FSceneViewFamily& ViewFamily)
+	{
+		if ((ViewFamily.RenderTarget == nullptr) || (ViewFamily.Views.Num() == 0))
+			return;
+
+		FRHITexture* FamilyTexture = ViewFamily.RenderTarget->GetRenderTargetTexture().GetReference();
+		if (FamilyTexture == nullptr)
+			return;
+
+		FRDGTextureRef SourceTexture = GraphBuilder.RegisterExternalTexture(CreateRenderTarget(FamilyTexture, TEXT("NDI Viewport Family Target")));
+		TapTexture(GraphBuilder, SourceTexture, ViewFamily.Views[0]->UnscaledViewRect);
+	}
+
+	FScreenPassTexture TapPostProcessingPass(FRDGBuilder& GraphBuilder, const FSceneView& View, const FPostProcessMaterialInputs& Inputs)
+	{
+#if (ENGINE_MAJOR_VERSION > 5) || ((ENGINE_MAJOR_VERSION == 5) && (ENGINE_MINOR_VERSION >= 4))
+		FScreenPassTexture SceneColor = FScreenPassTexture::CopyFromSlice(GraphBuilder, Inputs.GetInput(EPostProcessMaterialInput::SceneColor));
+#else
+		FScreenPassTexture SceneColor = Inputs.GetInput(EPostProcessMaterialInput::SceneColor);
+#endif
+
+		// Only the first view of the family is sent
+		if ((View.Family != nullptr) && (View.Family->Views.Num() > 0) && (View.Family->Views[0] == &View))
+			TapTexture(GraphBuilder, SceneColor.Texture, SceneColor.ViewRect);
+
+#if (ENGINE_MAJOR_VERSION > 5) || ((ENGINE_MAJOR_VERSION == 5) && (ENGINE_MINOR_VERSION >= 4))
+		return Inputs.ReturnUntouchedSceneColorForPostProcessing(GraphBuilder);
+#else
+		// The scene colour is left untouched, but must be written to the override output when the pass has one
+		if (Inputs.OverrideOutput.IsValid())
+		{
+			AddDrawTexturePass(GraphBuilder, static_cast<const FViewInfo&>(View), SceneColor, Inputs.OverrideOutput);
+			return Inputs.OverrideOutput;
+		}
+
+		return SceneColor;
+#endif
+	}
+
+	/**
+		Copies the view rectangle of a texture into the texture the sender converts at the end of the frame
+	*/
+	void TapTexture(FRDGBuilder& GraphBuilder, FRDGTextureRef SourceTexture, const FIntRect& SourceRect)
+	{
+		FScopeLock Lock(&TapSyncContext);
+
+		if ((Sender == nullptr) || (SourceTexture == nullptr) || (SourceRect.Area() <= 0))
+			return;
+
+		RDG_EVENT_SCOPE(GraphBuilder, "NDI Viewport Tap");
+		RDG_GPU_STAT_SCOPE(GraphBuilder, NDIViewportTap);
+
+		FIntPoint TapSize = SourceRect.Size();
+		EPixelFormat TapFormat = SourceTexture->Desc.Format;
+
+		// The same texture is used every frame, unless the size or format of the viewport changes
+		if (!TapTarget.IsValid() || (TapTargetDescriptor.Extent != TapSize) || (TapTargetDescriptor.Format != TapFormat))
+		{
+			TapTargetDescriptor = FPooledRenderTargetDesc::Create2DDesc(TapSize, TapFormat, FClearValueBinding::None,
+																		TexCreate_None, TexCreate_RenderTargetable, false);
+			TapTarget.SafeRelease();
+			GRenderTargetPool.FindFreeElement(GraphBuilder.RHICmdList, TapTargetDescriptor, TapTarget, TEXT("NDI Viewport Tap"));
+		}
+
+		FRDGTextureRef TargetTexture = GraphBuilder.RegisterExternalTexture(TapTarget);
+
+		FRHICopyTextureInfo CopyInfo;
+		CopyInfo.SourcePosition = FIntVector(SourceRect.Min.X, SourceRect.Min.Y, 0);
+		CopyInfo.Size = FIntVector(TapSize.X, TapSize.Y, 1);
+		AddCopyTexturePass(GraphBuilder, SourceTexture, TargetTexture, CopyInfo);
+
+		// Leave the texture readable by the conversion of the sender, which happens outside of the graph
+		GraphBuilder.QueueTextureExtraction(TargetTexture, &TapTarget);
+
+#if ENGINE_MAJOR_VERSION >= 5
+		Sender->ChangeInputTextureRHI(TapTarget->GetRHI());
+#elif ENGINE_MAJOR_VERSION == 4
+		Sender->ChangeInputTextureRHI(TapTarget->GetRenderTargetItem().ShaderResourceTexture);
+#else
+		#error "Unsupported engine major version"
+#endif
+	}
+
+private:
+	TWeakObjectPtr<UNDIViewportCaptureComponent> Owner;
+	UNDIMediaSender* Sender = nullptr;
+	const ENDIViewportCaptureMode CaptureMode;
+
+	FCriticalSection TapSyncContext;
+
+	TRefCountPtr<IPooledRenderTarget> TapTarget;
+	FPooledRenderTargetDesc TapTargetDescriptor;
+};
+
+
+
 UNDIViewportCaptureComponent::UNDIViewportCaptureComponent(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
 {
@@ -50,11 +239,16 @@ void UNDIViewportCaptureComponent::InitializeComponent()
 		this->NDIMediaSource->OnBroadcastConfigurationChanged.RemoveAll(this);
 		this->NDIMediaSource->OnBroadcastConfigurationChanged.AddDynamic(
 			this, &UNDIViewportCaptureComponent::OnBroadcastConfigurationChanged);
+
+		if (CaptureMode != ENDIViewportCaptureMode::SceneCapture)
+			StartViewportTap();
 	}
 }
 
 void UNDIViewportCaptureComponent::UninitializeComponent()
 {
+	StopViewportTap();
+
 	if (IsValid(NDIMediaSource))
 	{
 		if (IsValid(TextureTarget))
@@ -88,6 +282,9 @@ bool UNDIViewportCaptureComponent::Initialize(UNDIMediaSender* InMediaSource)
 			this->NDIMediaSource->OnBroadcastConfigurationChanged.RemoveAll(this);
 			this->NDIMediaSource->OnBroadcastConfigurationChanged.AddDynamic(
 				this, &UNDIViewportCaptureComponent::OnBroadcastConfigurationChanged);
+
+			if (CaptureMode != ENDIViewportCaptureMode::SceneCapture)
+				StartViewportTap();
 		}
 	}
 
@@ -175,6 +372,24 @@ void UNDIViewportCaptureComponent::ChangeCaptureSettings(FIntPoint InCaptureSize
 	this->TextureTarget->ResizeTarget(this->CaptureSize.X, this->CaptureSize.Y);
 }
 
+/**
+	Changes whether to render the scene again from this component, or to take the frames of the game viewport
+
+	@param InCaptureMode Where to get the frames to send from
+*/
+void UNDIViewportCaptureComponent::ChangeCaptureMode(ENDIViewportCaptureMode InCaptureMode)
+{
+	if (InCaptureMode == this->CaptureMode)
+		return;
+
+	StopViewportTap();
+
+	this->CaptureMode = InCaptureMode;
+
+	if ((CaptureMode != ENDIViewportCaptureMode::SceneCapture) && IsValid(NDIMediaSource))
+		StartViewportTap();
+}
+
 /**
 	Determines the current tally information. If you specify a timeout then it will wait until it has
 	changed, otherwise it will simply poll it and return the current tally immediately
@@ -225,6 +440,10 @@ void UNDIViewportCaptureComponent::UpdateSceneCaptureContents(FSceneInterface* S
 	if (TextureTarget == nullptr)
 		return;
 
+	// The frames come from the game viewport instead, so the scene is not rendered again
+	if (CaptureMode != ENDIViewportCaptureMode::SceneCapture)
+		return;
+
 	if (IsValid(NDIMediaSource))
 	{
 		NDIMediaSource->ChangeVideoTexture(TextureTarget);
@@ -253,3 +472,48 @@ void UNDIViewportCaptureComponent::OnBroadcastConfigurationChanged(UNDIMediaSend
 		ChangeCaptureSettings(Sender->GetFrameSize(), Sender->GetFrameRate());
 	}
 }
+
+/**
+	Starts sending the frames of the game viewport, instead of rendering the scene again
+*/
+void UNDIViewportCaptureComponent::StartViewportTap()
+{
+	check(IsInGameThread());
+
+	if (ViewportTapExtension.IsValid() || !IsValid(NDIMediaSource))
+		return;
+
+	// Only the colour before tone mapping is linear, the other stages are already encoded for display
+	NDIMediaSource->PerformLinearTosRGBConversion(CaptureMode == ENDIViewportCaptureMode::ViewportAfterMotionBlur);
+	NDIMediaSource->ChangeAlphaRemap(AlphaMin, AlphaMax);
+
+	ViewportTapExtension = FSceneViewExtensions::NewExtension<FNDIViewportTapExtension>(this, NDIMediaSource, CaptureMode);
+}
+
+/**
+	Stops sending the frames of the game viewport
+*/
+void UNDIViewportCaptureComponent::StopViewportTap()
+{
+	check(IsInGameThread());
+
+	if (!ViewportTapExtension.IsValid())
+		return;
+
+	ViewportTapExtension->Stop();
+	ViewportTapExtension.Reset();
+
+	if (IsValid(NDIMediaSource))
+	{
+		// Scene captures are linear
+		NDIMediaSource->PerformLinearTosRGBConversion(true);
+
+		// Release the tapped texture after the frames which were already tapped
+		UNDIMediaSender* Sender = NDIMediaSource;
+		ENQUEUE_RENDER_COMMAND(NDIViewportTapStop)(
+			[Sender](FRHICommandListImmediate& RHICmdList)
+			{
+				Sender->ChangeInputTextureRHI(nullptr);
+			});
+	}
+}
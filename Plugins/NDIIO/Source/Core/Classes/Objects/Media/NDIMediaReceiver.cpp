@@ -6,7 +6,10 @@
 */
 
 #include <Objects/Media/NDIMediaReceiver.h>
+#include <Services/NDIFinderService.h>
 #include <Misc/CoreDelegates.h>
+#include <SceneView.h>
+#include <SceneViewExtension.h>
 #include <TextureResource.h>
 #include <RenderTargetPool.h>
 #include <GlobalShader.h>
@@ -15,7 +18,10 @@
 #include <MediaIOCorePlayerBase.h>
 #include <Materials/MaterialInstanceDynamic.h>
 #include <Async/Async.h>
+#include <AudioDevice.h>
+#include <Engine/Engine.h>
 #include <GenericPlatform/GenericPlatformProcess.h>
+#include <HAL/PlatformTime.h>
 #include <Misc/EngineVersionComparison.h>
 #include <UObject/UObjectGlobals.h>
 #include <UObject/Package.h>
@@ -28,6 +34,62 @@
 
 #include <string>
 
+/**
+	A scene view extension which tells a standalone receiver when a scene is about to be rendered, so that the
+	latency of the video frame it displays is measured where it is actually drawn, whether late latching or not
+*/
+class FNDIReceiverLatchExtension : public FSceneViewExtensionBase
+{
+public:
+	FNDIReceiverLatchExtension(const FAutoRegister& AutoRegister, UNDIMediaReceiver* InReceiver)
+		: FSceneViewExtensionBase(AutoRegister)
+		, Receiver(InReceiver)
+	{}
+
+	/**
+		Stops notifying the receiver, for the frames still being rendered
+	*/
+	void Stop()
+	{
+		FScopeLock Lock(&LatchSyncContext);
+
+		this->Receiver = nullptr;
+	}
+
+	virtual void SetupViewFamily(FSceneViewFamily& InViewFamily) override {}
+	virtual void SetupView(FSceneViewFamily& InViewFamily, FSceneView& InView) override {}
+	virtual void BeginRenderViewFamily(FSceneViewFamily& InViewFamily) override {}
+
+#if ENGINE_MAJOR_VERSION >= 5
+	virtual void PreRenderViewFamily_RenderThread(FRDGBuilder& GraphBuilder, FSceneViewFamily& InViewFamily) override
+	{
+		NotifyReceiver();
+	}
+#elif ENGINE_MAJOR_VERSION == 4
+	virtual void PreRenderViewFamily_RenderThread(FRHICommandListImmediate& RHICmdList, FSceneViewFamily& InViewFamily) override
+	{
+		NotifyReceiver();
+	}
+
+	virtual void PreRenderView_RenderThread(FRHICommandListImmediate& RHICmdList, FSceneView& InView) override {}
+#else
+	#error "Unsupported engine major version"
+#endif
+
+private:
+	void NotifyReceiver()
+	{
+		FScopeLock Lock(&LatchSyncContext);
+
+		if (this->Receiver != nullptr)
+			this->Receiver->OnPreRenderViewFamily_RenderThread();
+	}
+
+	UNDIMediaReceiver* Receiver = nullptr;
+	FCriticalSection LatchSyncContext;
+};
+
+
 UNDIMediaReceiver::UNDIMediaReceiver()
 {
 	this->InternalVideoTexture = NewObject<UNDIMediaTexture2D>(GetTransientPackage(), UNDIMediaTexture2D::StaticClass(), NAME_None, RF_Transient | RF_MarkAsNative);
@@ -40,8 +102,23 @@ bool UNDIMediaReceiver::Initialize(const FNDIConnectionInformation& InConnection
 {
 	if (this->p_receive_instance == nullptr)
 	{
-		if (IsValid(this->InternalVideoTexture))
-			this->InternalVideoTexture->UpdateResource();
+		// Receivers without video never display a frame, so they do not need a texture resource. A texture resource
+		// left from an earlier initialization is only cleared back to the placeholder, rather than recreated.
+		if (IsValid(this->InternalVideoTexture) && HasVideoProfile())
+		{
+			if (GetInternalVideoTextureResource() != nullptr)
+				this->InternalVideoTexture->UpdateTextureReference(FRHICommandListExecutor::GetImmediateCommandList(), nullptr);
+			else
+				this->InternalVideoTexture->UpdateResource();
+		}
+
+		// The audio generated for the sound waves is heard once the buffers queued in the audio device have played
+		if (GEngine != nullptr)
+		{
+			FAudioDeviceHandle AudioDevice = GEngine->GetMainAudioDevice();
+			if (AudioDevice.IsValid() && (AudioDevice->GetSampleRate() > 0.f))
+				AudioOutputLatency = (double)AudioDevice->GetBufferLength() * AudioDevice->GetNumBuffers() / AudioDevice->GetSampleRate();
+		}
 
 		// create a non-connected receiver instance
 		NDIlib_recv_create_v3_t settings;
@@ -54,6 +131,8 @@ bool UNDIMediaReceiver::Initialize(const FNDIConnectionInformation& InConnection
 		// check if it was successful
 		if (p_receive_instance != nullptr)
 		{
+			CurrentConnection = MakeShared<FNDIReceiverConnection, ESPMode::ThreadSafe>(p_receive_instance, nullptr);
+
 			// If the incoming connection information is valid
 			if (InConnectionInformation.IsValid())
 			{
@@ -66,32 +145,49 @@ bool UNDIMediaReceiver::Initialize(const FNDIConnectionInformation& InConnection
 				this->OnNDIReceiverVideoCaptureEvent.Remove(VideoCaptureEventHandle);
 				VideoCaptureEventHandle = this->OnNDIReceiverVideoCaptureEvent.AddLambda([this](UNDIMediaReceiver* receiver, const NDIlib_video_frame_v2_t& video_frame)
 				{
-					FTextureRHIRef ConversionTexture = this->DisplayFrame(video_frame);
-					if (ConversionTexture != nullptr)
-					{
-						if ((GetVideoTextureResource() != nullptr) && (GetVideoTextureResource()->TextureRHI != ConversionTexture))
-						{
-							GetVideoTextureResource()->TextureRHI = ConversionTexture;
-							RHIUpdateTextureReference(this->VideoTexture->TextureReference.TextureReferenceRHI, ConversionTexture);
-						}
-						if ((GetInternalVideoTextureResource() != nullptr) && (GetInternalVideoTextureResource()->TextureRHI != ConversionTexture))
-						{
-							GetInternalVideoTextureResource()->TextureRHI = ConversionTexture;
-							RHIUpdateTextureReference(this->InternalVideoTexture->TextureReference.TextureReferenceRHI, ConversionTexture);
-						}
-					}
+					this->PresentFrame(video_frame);
 				});
 
 				// We don't want to limit the engine rendering speed to the sync rate of the connection hook
 				// into the core delegates render thread 'EndFrame'
+				FCoreDelegates::OnBeginFrameRT.Remove(FrameBeginRTHandle);
+				FrameBeginRTHandle.Reset();
 				FCoreDelegates::OnEndFrameRT.Remove(FrameEndRTHandle);
 				FrameEndRTHandle.Reset();
-				FrameEndRTHandle = FCoreDelegates::OnEndFrameRT.AddLambda([this]()
+				FCoreDelegates::OnEndFrame.Remove(FrameEndHandle);
+				FrameEndHandle.Reset();
+				if (LatchExtension.IsValid())
 				{
-					while(this->CaptureConnectedMetadata())
-						; // Potential improvement: limit how much metadata is processed, to avoid appearing to lock up due to a metadata flood
-					this->CaptureConnectedVideo();
-				});
+					LatchExtension->Stop();
+					LatchExtension.Reset();
+				}
+
+				if (HasVideoProfile())
+				{
+					// Both ends of the render frame are hooked whether late latching or not, so that it can be
+					// toggled while receiving, and the latency of either way measured
+					FrameBeginRTHandle = FCoreDelegates::OnBeginFrameRT.AddLambda([this]()
+					{
+						this->OnBeginFrame_RenderThread();
+					});
+					FrameEndRTHandle = FCoreDelegates::OnEndFrameRT.AddLambda([this]()
+					{
+						this->OnEndFrame_RenderThread();
+					});
+
+					// The latency of the frame displayed is measured when the scene is about to be rendered
+					LatchExtension = FSceneViewExtensions::NewExtension<FNDIReceiverLatchExtension>(this);
+				}
+				else
+				{
+					// Without video there is nothing to do on the render thread, the audio is pulled by the sound
+					// waves, and the metadata is captured at the end of the game thread frame
+					FrameEndHandle = FCoreDelegates::OnEndFrame.AddLambda([this]()
+					{
+						while(this->CaptureConnectedMetadata())
+							;
+					});
+				}
 
 #if UE_EDITOR
 				// We don't want to provide perceived issues with the plugin not working so
@@ -122,58 +218,233 @@ bool UNDIMediaReceiver::Initialize(UNDIMediaReceiver::EUsage InUsage)
 }
 
 
+/**
+	Returns the time of a frame on the clock of the source, in seconds. The timestamp is when the frame was sent, and
+	is used when the sender provides it, since the timecode is only as regular as the sender makes it.
+*/
+static double GetAlignmentTime(int64_t timestamp, int64_t timecode)
+{
+	return (timestamp != NDIlib_recv_timestamp_undefined ? timestamp : timecode) / 1e+7;
+}
+
+/**
+	Destroys a receiver and its frame sync on a worker thread, since the NDI SDK can take a while to close a
+	connection and the connections being replaced are released from the render thread
+*/
+void UNDIMediaReceiver::DestroyConnectionAsync(NDIlib_recv_instance_t receive_instance, NDIlib_framesync_instance_t framesync_instance)
+{
+	if ((receive_instance == nullptr) && (framesync_instance == nullptr))
+		return;
+
+	AsyncTask(ENamedThreads::AnyBackgroundThreadNormalTask, [receive_instance, framesync_instance]()
+	{
+		if (framesync_instance != nullptr)
+			NDIlib_framesync_destroy(framesync_instance);
+
+		if (receive_instance != nullptr)
+			NDIlib_recv_destroy(receive_instance);
+	});
+}
+
+/**
+	Releases the current connection on a worker thread, for the same reason. Frames still referenced keep the
+	connection alive, in which case it is destroyed when the last of them is released.
+*/
+static void ReleaseConnectionAsync(TSharedPtr<FNDIReceiverConnection, ESPMode::ThreadSafe>&& Connection)
+{
+	if (!Connection.IsValid())
+		return;
+
+	AsyncTask(ENamedThreads::AnyBackgroundThreadNormalTask, [Connection = MoveTemp(Connection)]() mutable
+	{
+		Connection.Reset();
+	});
+}
+
 void UNDIMediaReceiver::StartConnection()
 {
-	FScopeLock RenderLock(&RenderSyncContext);
-	FScopeLock AudioLock(&AudioSyncContext);
-	FScopeLock MetadataLock(&MetadataSyncContext);
+	StartConnectionAt(this->ConnectionInformation.Url);
+}
 
+/**
+	Starts the connection to the source at the address given, which may be newer than that of the connection
+	information
+*/
+void UNDIMediaReceiver::StartConnectionAt(const FString& InUrl)
+{
 	if (this->ConnectionInformation.IsValid())
 	{
 		// Create a non-connected receiver instance
 		NDIlib_recv_create_v3_t settings;
 		settings.allow_video_fields = true;
-		settings.bandwidth = this->ConnectionInformation;
+		settings.bandwidth = GetReceiveBandwidth();
 		settings.color_format = NDIlib_recv_color_format_fastest;
 
-		// Do the conversion on the connection information
-		// Beware of the limited lifetime of TCHAR_TO_UTF8 values
-		NDIlib_source_t connection;
+		// Only metadata can be received without a frame sync
+		const bool bCreateFramesync = (ReceiveProfile != ENDIReceiveProfile::MetadataOnly);
+
+		// Do the conversion on the connection information now, the worker owns the strings
 		std::string SourceNameStr(TCHAR_TO_UTF8(*this->ConnectionInformation.GetNDIName()));
-		connection.p_ndi_name = SourceNameStr.c_str();
-		std::string UrlStr(TCHAR_TO_UTF8(*this->ConnectionInformation.Url));
-		connection.p_url_address = UrlStr.c_str();
+		std::string UrlStr(TCHAR_TO_UTF8(*InUrl));
 
-		// Create a receiver and connect to the source
-		auto* receive_instance = NDIlib_recv_create_v3(&settings);
-		NDIlib_recv_connect(receive_instance, &connection);
+		// Any connection still being established is superseded by this one
+		uint32 Generation = 0;
+		NDIlib_recv_instance_t cancelled_receive_instance = nullptr;
+		NDIlib_framesync_instance_t cancelled_framesync_instance = nullptr;
+		{
+			FScopeLock Lock(&PendingConnection->SyncContext);
 
-		// Get rid of existing connection
-		StopConnection();
+			Generation = ++PendingConnection->Generation;
+			PendingConnection->RequestCycles = FPlatformTime::Cycles64();
 
-		// set the receiver to the new connection
-		p_receive_instance = receive_instance;
+			cancelled_receive_instance = PendingConnection->p_receive_instance;
+			cancelled_framesync_instance = PendingConnection->p_framesync_instance;
+			PendingConnection->p_receive_instance = nullptr;
+			PendingConnection->p_framesync_instance = nullptr;
+		}
+		DestroyConnectionAsync(cancelled_receive_instance, cancelled_framesync_instance);
+
+		// Creating the receiver and the frame sync blocks while the connection is negotiated, so it is done on a
+		// worker, while the current connection carries on being displayed
+		AsyncTask(ENamedThreads::AnyBackgroundThreadNormalTask,
+				  [Pending = PendingConnection, Generation, settings, bCreateFramesync, SourceNameStr, UrlStr]()
+		{
+			NDIlib_source_t connection;
+			connection.p_ndi_name = SourceNameStr.c_str();
+			connection.p_url_address = UrlStr.c_str();
+
+			// Create a receiver and connect to the source
+			NDIlib_recv_instance_t receive_instance = NDIlib_recv_create_v3(&settings);
+			if (receive_instance == nullptr)
+				return;
+
+			NDIlib_recv_connect(receive_instance, &connection);
+			NDIlib_framesync_instance_t framesync_instance = bCreateFramesync ? NDIlib_framesync_create(receive_instance) : nullptr;
+
+			{
+				FScopeLock Lock(&Pending->SyncContext);
 
-		// create a new frame sync instance
-		p_framesync_instance = NDIlib_framesync_create(p_receive_instance);
+				// Hand the connection over, unless another connection has been requested in the meantime
+				if (Pending->Generation == Generation)
+				{
+					Pending->p_receive_instance = receive_instance;
+					Pending->p_framesync_instance = framesync_instance;
+					return;
+				}
+			}
+
+			if (framesync_instance != nullptr)
+				NDIlib_framesync_destroy(framesync_instance);
+			NDIlib_recv_destroy(receive_instance);
+		});
 	}
 }
 
 void UNDIMediaReceiver::StopConnection()
 {
-	FScopeLock RenderLock(&RenderSyncContext);
-	FScopeLock AudioLock(&AudioSyncContext);
-	FScopeLock MetadataLock(&MetadataSyncContext);
+	CancelPendingConnection();
 
-	// destroy the framesync instance
-	if (p_framesync_instance != nullptr)
-		NDIlib_framesync_destroy(p_framesync_instance);
-	p_framesync_instance = nullptr;
+	TSharedPtr<FNDIReceiverConnection, ESPMode::ThreadSafe> OldConnection;
+	{
+		FScopeLock RenderLock(&RenderSyncContext);
+		FScopeLock AudioLock(&AudioSyncContext);
+		FScopeLock MetadataLock(&MetadataSyncContext);
 
-	// Free the receiver
-	if (p_receive_instance != nullptr)
-		NDIlib_recv_destroy(p_receive_instance);
-	p_receive_instance = nullptr;
+		OldConnection = MoveTemp(CurrentConnection);
+		p_receive_instance = nullptr;
+		p_framesync_instance = nullptr;
+	}
+
+	// No thread can be using the connection anymore, so it is destroyed without holding up the others
+	ReleaseConnectionAsync(MoveTemp(OldConnection));
+}
+
+/**
+	Forgets the connection being established on the worker thread, if any
+*/
+void UNDIMediaReceiver::CancelPendingConnection()
+{
+	NDIlib_recv_instance_t receive_instance = nullptr;
+	NDIlib_framesync_instance_t framesync_instance = nullptr;
+	{
+		FScopeLock Lock(&PendingConnection->SyncContext);
+
+		++PendingConnection->Generation;
+
+		receive_instance = PendingConnection->p_receive_instance;
+		framesync_instance = PendingConnection->p_framesync_instance;
+		PendingConnection->p_receive_instance = nullptr;
+		PendingConnection->p_framesync_instance = nullptr;
+	}
+
+	DestroyConnectionAsync(receive_instance, framesync_instance);
+}
+
+/**
+	Replaces the current connection with the one established on the worker thread, once it has delivered its first
+	video frame, so that the previous source is displayed until then rather than black. Readers hold the sync
+	contexts for as long as they use a connection, so the old connection is released once the pointers are swapped.
+*/
+void UNDIMediaReceiver::PromotePendingConnection()
+{
+	NDIlib_recv_instance_t receive_instance = nullptr;
+	NDIlib_framesync_instance_t framesync_instance = nullptr;
+	uint64 RequestCycles = 0;
+	{
+		FScopeLock Lock(&PendingConnection->SyncContext);
+
+		if (PendingConnection->p_receive_instance == nullptr)
+			return;
+
+		// Without a current connection there is nothing to keep on display
+		bool bIsReady = (p_framesync_instance == nullptr);
+
+		if (bIsReady == false)
+		{
+			if (ReceivesVideo() == false)
+			{
+				bIsReady = NDIlib_recv_get_no_connections(PendingConnection->p_receive_instance) > 0;
+			}
+			else
+			{
+				// The frame sync only returns a frame once the source has delivered one
+				NDIlib_video_frame_v2_t video_frame;
+				NDIlib_framesync_capture_video(PendingConnection->p_framesync_instance, &video_frame, NDIlib_frame_format_type_progressive);
+				bIsReady = (video_frame.p_data != nullptr);
+				NDIlib_framesync_free_video(PendingConnection->p_framesync_instance, &video_frame);
+			}
+		}
+
+		if (bIsReady == false)
+			return;
+
+		receive_instance = PendingConnection->p_receive_instance;
+		framesync_instance = PendingConnection->p_framesync_instance;
+		RequestCycles = PendingConnection->RequestCycles;
+		PendingConnection->p_receive_instance = nullptr;
+		PendingConnection->p_framesync_instance = nullptr;
+	}
+
+	TSharedPtr<FNDIReceiverConnection, ESPMode::ThreadSafe> OldConnection;
+	{
+		FScopeLock RenderLock(&RenderSyncContext);
+		FScopeLock AudioLock(&AudioSyncContext);
+		FScopeLock MetadataLock(&MetadataSyncContext);
+
+		OldConnection = MoveTemp(CurrentConnection);
+		CurrentConnection = MakeShared<FNDIReceiverConnection, ESPMode::ThreadSafe>(receive_instance, framesync_instance);
+		p_receive_instance = receive_instance;
+		p_framesync_instance = framesync_instance;
+	}
+
+	ReleaseConnectionAsync(MoveTemp(OldConnection));
+
+	// The timestamps of another source have nothing to do with those of the previous one
+	ResetAudioVideoAlignment();
+
+	// A connection replacing one adopted at a lower bandwidth is not a change of source
+	if (RequestCycles != 0)
+		FirstFrameRequestCycles = RequestCycles;
 }
 
 /**
@@ -181,7 +452,8 @@ void UNDIMediaReceiver::StopConnection()
 */
 void UNDIMediaReceiver::ChangeConnection(const FNDIConnectionInformation& InConnectionInformation)
 {
-	// Ensure some thread-safety because our 'Capture Connected Video' function is called on the render thread
+	// Ensure some thread-safety because our 'Capture Connected Video' function is called on the render thread.
+	// The new connection is established on a worker, so the locks are only held briefly.
 	FScopeLock RenderLock(&RenderSyncContext);
 	FScopeLock AudioLock(&AudioSyncContext);
 	FScopeLock MetadataLock(&MetadataSyncContext);
@@ -220,6 +492,10 @@ void UNDIMediaReceiver::ChangeConnection(const FNDIConnectionInformation& InConn
 				{
 					// Connection information is valid, and something has changed that requires the connection to be remade
 
+					// The new source is given the timeouts to connect before the watchdog steps in
+					if (bSourceChanged)
+						ResetWatchdog();
+
 					StartConnection();
 				}
 			}
@@ -233,6 +509,43 @@ void UNDIMediaReceiver::ChangeConnection(const FNDIConnectionInformation& InConn
 	}
 }
 
+/**
+	Takes over a connection which is already receiving from the source, so that its frames are displayed from the
+	next frame on
+*/
+void UNDIMediaReceiver::AdoptConnection(const FNDIConnectionInformation& InConnectionInformation, ENDISourceBandwidth InConnectedBandwidth,
+										NDIlib_recv_instance_t InReceiveInstance, NDIlib_framesync_instance_t InFramesyncInstance)
+{
+	CancelPendingConnection();
+
+	TSharedPtr<FNDIReceiverConnection, ESPMode::ThreadSafe> OldConnection;
+	{
+		FScopeLock RenderLock(&RenderSyncContext);
+		FScopeLock AudioLock(&AudioSyncContext);
+		FScopeLock MetadataLock(&MetadataSyncContext);
+
+		OldConnection = MoveTemp(CurrentConnection);
+		CurrentConnection = MakeShared<FNDIReceiverConnection, ESPMode::ThreadSafe>(InReceiveInstance, InFramesyncInstance);
+		p_receive_instance = InReceiveInstance;
+		p_framesync_instance = InFramesyncInstance;
+
+		this->ConnectionInformation = InConnectionInformation;
+		FirstFrameRequestCycles = FPlatformTime::Cycles64();
+		ResetWatchdog();
+	}
+
+	ReleaseConnectionAsync(MoveTemp(OldConnection));
+
+	if (InConnectedBandwidth != InConnectionInformation.Bandwidth)
+	{
+		StartConnection();
+
+		// The switch to the requested bandwidth does not count as the first frame of the source
+		FScopeLock Lock(&PendingConnection->SyncContext);
+		PendingConnection->RequestCycles = 0;
+	}
+}
+
 /**
 	Attempts to change the Video Texture object used as the video frame capture object
 */
@@ -268,14 +581,39 @@ int32 UNDIMediaReceiver::GeneratePCMData(UNDIMediaSoundWave* AudioWave, uint8* P
 	int32 requested_no_channels = IsValid(AudioWave) ? AudioWave->NumChannels : 1;
 	int32 requested_no_frames = SamplesNeeded / requested_no_channels;
 
-	if ((p_framesync_instance != nullptr) && (ConnectionInformation.bMuteAudio == false))
+	if ((p_framesync_instance != nullptr) && ReceivesAudio())
 	{
 		int available_no_frames = NDIlib_framesync_audio_queue_depth(p_framesync_instance);	// Samples per channel
 
-		if (available_no_frames > 0)
+		// The audio is delayed by leaving as much of it queued in the frame sync, and anything queued well past
+		// the delay is dropped, so that the delay can be shortened again
+		int delay_no_frames = 0;
+		if (bAlignAudioVideo)
 		{
+			delay_no_frames = (int)(AudioDelayTime.load() * requested_frame_rate);
+
+			int excess_no_frames = available_no_frames - delay_no_frames - 2 * requested_no_frames;
+			if (excess_no_frames > 0)
+			{
+				NDIlib_audio_frame_v2_t excess_frame;
+				NDIlib_framesync_capture_audio(p_framesync_instance, &excess_frame, requested_frame_rate, 0, excess_no_frames);
+				NDIlib_framesync_free_audio(p_framesync_instance, &excess_frame);
+
+				available_no_frames -= excess_no_frames;
+			}
+		}
+
+		if (available_no_frames > delay_no_frames)
+		{
+			// The frame sync only queues audio the source has actually sent
+			LastMediaCycles = FPlatformTime::Cycles64();
+
 			NDIlib_audio_frame_v2_t audio_frame;
-			NDIlib_framesync_capture_audio(p_framesync_instance, &audio_frame, requested_frame_rate, 0, FMath::Min(available_no_frames, requested_no_frames));
+			NDIlib_framesync_capture_audio(p_framesync_instance, &audio_frame, requested_frame_rate, 0, FMath::Min(available_no_frames - delay_no_frames, requested_no_frames));
+
+			// The first sample of the frame is heard once the audio already queued in the audio device has played
+			AudioSourceOffset = GetAlignmentTime(audio_frame.timestamp, audio_frame.timecode) - (FPlatformTime::Seconds() + AudioOutputLatency);
+			bHasAudioSourceOffset = true;
 
 			if (requested_no_channels == audio_frame.no_channels)
 			{
@@ -416,7 +754,7 @@ int32 UNDIMediaReceiver::GetAudioChannels()
 
 	int32 no_channels = 0;
 
-	if ((p_framesync_instance != nullptr) && (ConnectionInformation.bMuteAudio == false))
+	if ((p_framesync_instance != nullptr) && ReceivesAudio())
 	{
 		int available_no_frames = NDIlib_framesync_audio_queue_depth(p_framesync_instance);	// Samples per channel
 
@@ -519,14 +857,32 @@ void UNDIMediaReceiver::Shutdown()
 	{
 		this->RenderTarget.SafeRelease();
 		this->RenderTargetDescriptor = FPooledRenderTargetDesc();
+
+		for (int32 RingIndex = 0; RingIndex < SourceTextureRingSize; ++RingIndex)
+		{
+			this->SourceTextureRing[RingIndex].SafeRelease();
+			this->SourceAlphaTextureRing[RingIndex].SafeRelease();
+		}
+		this->SourceTexture.SafeRelease();
+		this->SourceAlphaTexture.SafeRelease();
 	});
 
 	this->OnNDIReceiverVideoCaptureEvent.Remove(VideoCaptureEventHandle);
 	VideoCaptureEventHandle.Reset();
 
 	// Unregister render thread frame end delegate lambda.
+	FCoreDelegates::OnBeginFrameRT.Remove(FrameBeginRTHandle);
+	FrameBeginRTHandle.Reset();
 	FCoreDelegates::OnEndFrameRT.Remove(FrameEndRTHandle);
 	FrameEndRTHandle.Reset();
+	FCoreDelegates::OnEndFrame.Remove(FrameEndHandle);
+	FrameEndHandle.Reset();
+
+	if (LatchExtension.IsValid())
+	{
+		LatchExtension->Stop();
+		LatchExtension.Reset();
+	}
 
 	// Move audio source collection to temporary, so that cleanup can be done without
 	// holding the lock (which could otherwise cause a deadlock if UNDIMediaSoundWave
@@ -556,22 +912,17 @@ void UNDIMediaReceiver::Shutdown()
 		}
 	}
 
+	CancelPendingConnection();
+
 	{
 		FScopeLock RenderLock(&RenderSyncContext);
 		FScopeLock AudioLock(&AudioSyncContext);
 		FScopeLock MetadataLock(&MetadataSyncContext);
 
-		if (p_receive_instance != nullptr)
-		{
-			if (p_framesync_instance != nullptr)
-			{
-				NDIlib_framesync_destroy(p_framesync_instance);
-				p_framesync_instance = nullptr;
-			}
-
-			NDIlib_recv_destroy(p_receive_instance);
-			p_receive_instance = nullptr;
-		}
+		// The connection is destroyed here, unless frames handed out from it are still referenced
+		CurrentConnection.Reset();
+		p_framesync_instance = nullptr;
+		p_receive_instance = nullptr;
 	}
 
 	// Reset the connection status of this object
@@ -579,6 +930,16 @@ void UNDIMediaReceiver::Shutdown()
 
 	this->ConnectionInformation.Reset();
 	this->PerformanceData.Reset();
+	this->FirstFrameRequestCycles = 0;
+	ResetWatchdog();
+	SetHealth(ENDIReceiverHealth::Healthy);
+
+	{
+		FScopeLock RenderLock(&RenderSyncContext);
+		HeldVideoFrames.Empty();
+		AlignmentCorrection = 0.0;
+		ResetAudioVideoAlignment();
+	}
 	this->FrameRate = FFrameRate(60, 1);
 	this->Resolution = FIntPoint(0, 0);
 	this->Timecode = FTimecode(0, FrameRate, true, true);
@@ -648,15 +1009,22 @@ bool UNDIMediaReceiver::CaptureConnectedVideo()
 	// Ensure thread safety
 	FScopeLock Lock(&RenderSyncContext);
 
+	// Switch over to a new connection once it has something to display
+	PromotePendingConnection();
+
+	// Reconnect when the connection has been lost
+	UpdateWatchdog();
+
 	bool bHaveCaptured = false;
 
 	// check for our frame sync object and that we are actually connected to the end point
-	if ((p_framesync_instance != nullptr) && (ConnectionInformation.bMuteVideo == false))
+	if ((p_framesync_instance != nullptr) && ReceivesVideo())
 	{
 		// Using a frame-sync we can always get data which is the magic and it will adapt
 		// to the frame-rate that it is being called with.
 		NDIlib_video_frame_v2_t video_frame;
 		NDIlib_framesync_capture_video(p_framesync_instance, &video_frame, NDIlib_frame_format_type_progressive);
+		bool bHandedOverFrame = false;
 
 		// Update our Performance Metrics
 		GatherPerformanceMetrics();
@@ -702,29 +1070,136 @@ bool UNDIMediaReceiver::CaptureConnectedVideo()
 				(video_frame.frame_format_type != LastFrameFormatType))
 			{
 				bHaveCaptured = true;
+				LastMediaCycles = FPlatformTime::Cycles64();
+
+				if (FirstFrameRequestCycles != 0)
+				{
+					this->PerformanceData.TimeToFirstFrame = (float)((FPlatformTime::Cycles64() - FirstFrameRequestCycles) * FPlatformTime::GetSecondsPerCycle64());
+					FirstFrameRequestCycles = 0;
+				}
 
 				LastFrameTimestamp = video_frame.timestamp;
 				LastFrameFormatType = video_frame.frame_format_type;
 
-				OnNDIReceiverVideoCaptureEvent.Broadcast(this, video_frame);
-
-				OnReceiverVideoReceived.Broadcast(this);
-
-				if (video_frame.p_metadata)
+				if (((VideoHoldTime > 0.0) || (HeldVideoFrames.Num() > 0)) && CurrentConnection.IsValid())
+				{
+					// The frame is held, and broadcast once it has been held for the video hold time
+					HeldVideoFrames.Emplace(FPlatformTime::Seconds(), MakeShared<FNDIVideoFrame, ESPMode::ThreadSafe>(CurrentConnection.ToSharedRef(), video_frame));
+					bHandedOverFrame = true;
+				}
+				else
 				{
-					FString Data(UTF8_TO_TCHAR(video_frame.p_metadata));
-					OnReceiverMetaDataReceived.Broadcast(this, Data, true);
+					bHandedOverFrame = BroadcastVideoFrame(video_frame);
 				}
 			}
 		}
 
-		// Release the video. You could keep the frame if you want and release it later.
-		NDIlib_framesync_free_video(p_framesync_instance, &video_frame);
+		// Release the video, unless it has been handed over to a frame handle
+		if (bHandedOverFrame == false)
+			NDIlib_framesync_free_video(p_framesync_instance, &video_frame);
 	}
 
+	ReleaseHeldVideoFrames();
+
 	return bHaveCaptured;
 }
 
+bool UNDIMediaReceiver::BroadcastVideoFrame(const NDIlib_video_frame_v2_t& video_frame, const FNDIVideoFramePtr& HeldFrame)
+{
+	bool bHandedOverFrame = false;
+
+	VideoSourceOffset = GetAlignmentTime(video_frame.timestamp, video_frame.timecode) - FPlatformTime::Seconds();
+	bHasVideoSourceOffset = true;
+	UpdateAudioVideoAlignment();
+
+	OnNDIReceiverVideoCaptureEvent.Broadcast(this, video_frame);
+
+	OnReceiverVideoReceived.Broadcast(this);
+
+	if (video_frame.p_metadata)
+	{
+		FString Data(UTF8_TO_TCHAR(video_frame.p_metadata));
+		OnReceiverMetaDataReceived.Broadcast(this, Data, true);
+	}
+
+	// Subscribers which keep the frame take over the captured buffer, which the last of them returns
+	// to the frame sync
+	if (OnNDIReceiverVideoFrameEvent.IsBound())
+	{
+		if (HeldFrame.IsValid())
+		{
+			OnNDIReceiverVideoFrameEvent.Broadcast(this, HeldFrame.ToSharedRef());
+		}
+		else if (CurrentConnection.IsValid())
+		{
+			bHandedOverFrame = true;
+			OnNDIReceiverVideoFrameEvent.Broadcast(this, MakeShared<FNDIVideoFrame, ESPMode::ThreadSafe>(CurrentConnection.ToSharedRef(), video_frame));
+		}
+	}
+
+	return bHandedOverFrame;
+}
+
+/**
+	Broadcasts the latest of the held video frames which have been held for the video hold time. The frames before
+	it are dropped, which is how the hold time shortens.
+*/
+void UNDIMediaReceiver::ReleaseHeldVideoFrames()
+{
+	const double Now = FPlatformTime::Seconds();
+
+	int32 NumDue = 0;
+	while ((NumDue < HeldVideoFrames.Num()) && (HeldVideoFrames[NumDue].Key + VideoHoldTime <= Now))
+		++NumDue;
+
+	if (NumDue == 0)
+		return;
+
+	FNDIVideoFramePtr Frame = HeldVideoFrames[NumDue - 1].Value;
+	HeldVideoFrames.RemoveAt(0, NumDue);
+
+	BroadcastVideoFrame(Frame->GetFrame(), Frame);
+}
+
+/**
+	Measures the offset between the audio heard and the video shown, and moves the correction a little towards the
+	requested offset on each frame. A positive correction holds the video, a negative one delays the audio.
+*/
+void UNDIMediaReceiver::UpdateAudioVideoAlignment()
+{
+	if ((bHasVideoSourceOffset == false) || (bHasAudioSourceOffset == false))
+		return;
+
+	const double Offset = VideoSourceOffset - AudioSourceOffset.load();
+	SmoothedAudioVideoOffset += (Offset - SmoothedAudioVideoOffset) * 0.1;
+
+	if (bAlignAudioVideo)
+	{
+		const double Error = SmoothedAudioVideoOffset - AudioVideoOffset / 1000.0;
+		const double MaxCorrection = FMath::Max(MaxAlignment, 0.f) / 1000.0;
+
+		AlignmentCorrection = FMath::Clamp(AlignmentCorrection + Error * 0.05, -MaxCorrection, MaxCorrection);
+	}
+	else
+	{
+		AlignmentCorrection = 0.0;
+	}
+
+	VideoHoldTime = FMath::Max(AlignmentCorrection, 0.0);
+	AudioDelayTime = FMath::Max(-AlignmentCorrection, 0.0);
+
+	this->PerformanceData.AudioVideoOffset = (float)(SmoothedAudioVideoOffset * 1000.0);
+	this->PerformanceData.VideoHoldTime = (float)(VideoHoldTime * 1000.0);
+	this->PerformanceData.AudioDelayTime = (float)(AudioDelayTime.load() * 1000.0);
+}
+
+void UNDIMediaReceiver::ResetAudioVideoAlignment()
+{
+	bHasVideoSourceOffset = false;
+	bHasAudioSourceOffset = false;
+	SmoothedAudioVideoOffset = 0.0;
+}
+
 
 /**
 	Attempts to capture an audio frame from the connected source.  If a new frame is captured, broadcast it to
@@ -736,7 +1211,7 @@ bool UNDIMediaReceiver::CaptureConnectedAudio()
 
 	bool bHaveCaptured = false;
 
-	if ((p_framesync_instance != nullptr) && (ConnectionInformation.bMuteAudio == false))
+	if ((p_framesync_instance != nullptr) && ReceivesAudio())
 	{
 		int no_samples = NDIlib_framesync_audio_queue_depth(p_framesync_instance);
 
@@ -755,6 +1230,7 @@ bool UNDIMediaReceiver::CaptureConnectedAudio()
 			if (available_samples > 0)
 			{
 				bHaveCaptured = true;
+				LastMediaCycles = FPlatformTime::Cycles64();
 
 				OnNDIReceiverAudioCaptureEvent.Broadcast(this, audio_frame);
 
@@ -772,6 +1248,13 @@ bool UNDIMediaReceiver::CaptureConnectedAudio()
 
 bool UNDIMediaReceiver::CaptureConnectedMetadata()
 {
+	// Receivers without video are not driven by the capture of video, so they switch connections here
+	if (HasVideoProfile() == false)
+	{
+		PromotePendingConnection();
+		UpdateWatchdog();
+	}
+
 	FScopeLock Lock(&MetadataSyncContext);
 
 	bool bHaveCaptured = false;
@@ -790,6 +1273,7 @@ bool UNDIMediaReceiver::CaptureConnectedMetadata()
 				if (metadata.length > 0)
 				{
 					bHaveCaptured = true;
+					LastMediaCycles = FPlatformTime::Cycles64();
 
 					OnNDIReceiverMetadataCaptureEvent.Broadcast(this, metadata);
 
@@ -805,6 +1289,53 @@ bool UNDIMediaReceiver::CaptureConnectedMetadata()
 	return bHaveCaptured;
 }
 
+/**
+	Latches the newest video frame at the start of the render frame, before the scene is rendered, when late latching
+*/
+void UNDIMediaReceiver::OnBeginFrame_RenderThread()
+{
+	if (bLateLatch)
+	{
+		CaptureStandaloneFrame_RenderThread();
+		bLatchedThisFrame = true;
+	}
+}
+
+/**
+	Measures how long before the scene rendering the frame displayed was captured, once for the first scene rendered
+	after each capture
+*/
+void UNDIMediaReceiver::OnPreRenderViewFamily_RenderThread()
+{
+	if (LastVideoCaptureCycles != 0)
+	{
+		this->PerformanceData.LatchLatency = (float)((FPlatformTime::Cycles64() - LastVideoCaptureCycles) * FPlatformTime::GetSecondsPerCycle64() * 1000.0);
+		LastVideoCaptureCycles = 0;
+	}
+}
+
+/**
+	Captures the video for the next render frame, unless it has been latched at the start of this one already. This
+	is also the fallback of late latching, for render frames whose start was not broadcast.
+*/
+void UNDIMediaReceiver::OnEndFrame_RenderThread()
+{
+	if (bLatchedThisFrame == false)
+		CaptureStandaloneFrame_RenderThread();
+
+	bLatchedThisFrame = false;
+}
+
+void UNDIMediaReceiver::CaptureStandaloneFrame_RenderThread()
+{
+	while(this->CaptureConnectedMetadata())
+		; // Potential improvement: limit how much metadata is processed, to avoid appearing to lock up due to a metadata flood
+
+	const uint64 CaptureStartCycles = FPlatformTime::Cycles64();
+	if (this->CaptureConnectedVideo())
+		LastVideoCaptureCycles = CaptureStartCycles;
+}
+
 
 void UNDIMediaReceiver::SetIsCurrentlyConnected(bool bConnected)
 {
@@ -871,6 +1402,155 @@ FTextureRHIRef UNDIMediaReceiver::DisplayFrame(const NDIlib_video_frame_v2_t& vi
 	return nullptr;
 }
 
+/**
+	Displays the video frame, and points the video textures of this object at the result
+*/
+void UNDIMediaReceiver::PresentFrame(const NDIlib_video_frame_v2_t& video_frame)
+{
+	FTextureRHIRef ConversionTexture = this->DisplayFrame(video_frame);
+	if (ConversionTexture != nullptr)
+	{
+		if ((GetVideoTextureResource() != nullptr) && (GetVideoTextureResource()->TextureRHI != ConversionTexture))
+		{
+			GetVideoTextureResource()->TextureRHI = ConversionTexture;
+			RHIUpdateTextureReference(this->VideoTexture->TextureReference.TextureReferenceRHI, ConversionTexture);
+		}
+		if ((GetInternalVideoTextureResource() != nullptr) && (GetInternalVideoTextureResource()->TextureRHI != ConversionTexture))
+		{
+			GetInternalVideoTextureResource()->TextureRHI = ConversionTexture;
+			RHIUpdateTextureReference(this->InternalVideoTexture->TextureReference.TextureReferenceRHI, ConversionTexture);
+		}
+	}
+}
+
+/**
+	Returns the output target, with the video cropped and fitted to it, when one is set, and otherwise a render target
+	of the frame size from the render target pool
+*/
+UNDIMediaReceiver::FConversionTarget UNDIMediaReceiver::GetConversionTarget(FRHICommandListImmediate& RHICmdList, const FIntPoint& FrameSize)
+{
+	FConversionTarget Target;
+
+	FTextureResource* OutputResource = GetOutputTargetResource();
+	if ((OutputResource != nullptr) && OutputResource->TextureRHI.IsValid())
+	{
+		// Converting straight into the output target needs no render target of our own
+		RenderTarget.SafeRelease();
+
+		const FIntPoint TargetSize(OutputResource->GetSizeX(), OutputResource->GetSizeY());
+
+		FVector2D CropMin(FMath::Clamp((float)OutputCropMin.X, 0.f, 1.f), FMath::Clamp((float)OutputCropMin.Y, 0.f, 1.f));
+		FVector2D CropMax(FMath::Clamp((float)OutputCropMax.X, 0.f, 1.f), FMath::Clamp((float)OutputCropMax.Y, 0.f, 1.f));
+		if ((CropMax.X <= CropMin.X) || (CropMax.Y <= CropMin.Y))
+		{
+			CropMin = FVector2D(0.f, 0.f);
+			CropMax = FVector2D(1.f, 1.f);
+		}
+
+		Target.Texture = OutputResource->TextureRHI;
+		Target.Viewport = FIntRect(FIntPoint(0, 0), TargetSize);
+		Target.UVOffset = CropMin;
+		Target.UVScale = CropMax - CropMin;
+
+		// The size of the cropped video, in pixels, and the scale from it to the output target which keeps its aspect
+		const float CropWidth = FMath::Max((float)Target.UVScale.X * FrameSize.X, 1.f);
+		const float CropHeight = FMath::Max((float)Target.UVScale.Y * FrameSize.Y, 1.f);
+		const float ScaleX = TargetSize.X / CropWidth;
+		const float ScaleY = TargetSize.Y / CropHeight;
+
+		if (OutputFit == ENDIOutputFit::Letterbox)
+		{
+			const float Scale = FMath::Min(ScaleX, ScaleY);
+			const FIntPoint FitSize(FMath::Clamp(FMath::RoundToInt(CropWidth * Scale), 1, TargetSize.X),
+			                        FMath::Clamp(FMath::RoundToInt(CropHeight * Scale), 1, TargetSize.Y));
+			const FIntPoint FitMin = (TargetSize - FitSize) / 2;
+			Target.Viewport = FIntRect(FitMin, FitMin + FitSize);
+
+			// The bars around the video are cleared to the clear color of the output target
+			if (FitSize != TargetSize)
+				Target.Actions = ERenderTargetActions::Clear_Store;
+		}
+		else if (OutputFit == ENDIOutputFit::Fill)
+		{
+			// Crop the edges of the video which fall outside of the output target, evenly on both sides
+			const float Scale = FMath::Max(ScaleX, ScaleY);
+			const FVector2D Visible(FMath::Min(ScaleX / Scale, 1.f), FMath::Min(ScaleY / Scale, 1.f));
+			Target.UVOffset += Target.UVScale * (FVector2D(1.f, 1.f) - Visible) * 0.5f;
+			Target.UVScale *= Visible;
+		}
+	}
+	else
+	{
+		if (!RenderTarget.IsValid())
+		{
+			// Find a free target-able texture from the render pool
+			GRenderTargetPool.FindFreeElement(RHICmdList, RenderTargetDescriptor, RenderTarget, TEXT("NDIIO"));
+		}
+
+#if ENGINE_MAJOR_VERSION >= 5
+		Target.Texture = RenderTarget->GetRHI();
+#elif ENGINE_MAJOR_VERSION == 4
+		Target.Texture = RenderTarget->GetRenderTargetItem().TargetableTexture;
+#else
+		#error "Unsupported engine major version"
+#endif
+		Target.Viewport = FIntRect(FIntPoint(0, 0), FrameSize);
+	}
+
+	return Target;
+}
+
+/**
+	Creates the ring of textures the frames are uploaded into in turn, so that the upload of a frame never waits on
+	the GPU still reading the texture of the previous frame
+*/
+void UNDIMediaReceiver::CreateSourceTextureRing(const TCHAR* Name, const FIntPoint& Size, EPixelFormat Format,
+												FTexture2DRHIRef (&Ring)[SourceTextureRingSize])
+{
+	for (int32 RingIndex = 0; RingIndex < SourceTextureRingSize; ++RingIndex)
+	{
+#if (ENGINE_MAJOR_VERSION > 5) || ((ENGINE_MAJOR_VERSION == 5) && (ENGINE_MINOR_VERSION >= 1))
+		const FRHITextureCreateDesc CreateDesc = FRHITextureCreateDesc::Create2D(Name)
+			.SetExtent(Size.X, Size.Y)
+			.SetFormat(Format)
+			.SetNumMips(1)
+			.SetFlags(ETextureCreateFlags::RenderTargetable | ETextureCreateFlags::Dynamic);
+
+		Ring[RingIndex] = RHICreateTexture(CreateDesc);
+#elif (ENGINE_MAJOR_VERSION == 4) || (ENGINE_MAJOR_VERSION == 5)
+		FRHIResourceCreateInfo CreateInfo(Name);
+		TRefCountPtr<FRHITexture2D> DummyTexture2DRHI;
+		RHICreateTargetableShaderResource2D(Size.X, Size.Y, Format, 1, TexCreate_Dynamic,
+											TexCreate_RenderTargetable, false, CreateInfo, Ring[RingIndex],
+											DummyTexture2DRHI);
+#else
+		#error "Unsupported engine major version"
+#endif
+	}
+}
+
+/**
+	Moves on to the next texture of the ring for the upload of the current frame
+*/
+void UNDIMediaReceiver::AdvanceSourceTextureRing()
+{
+	SourceTextureRingIndex = (SourceTextureRingIndex + 1) % SourceTextureRingSize;
+
+	SourceTexture = SourceTextureRing[SourceTextureRingIndex];
+	SourceAlphaTexture = SourceAlphaTextureRing[SourceTextureRingIndex];
+}
+
+/**
+	Records the time the render thread spent uploading the current frame to the GPU
+*/
+void UNDIMediaReceiver::RecordVideoUploadTime(uint64 UploadStartCycles)
+{
+	float UploadTime = (float)((FPlatformTime::Cycles64() - UploadStartCycles) * FPlatformTime::GetSecondsPerCycle64() * 1000.0);
+
+	this->PerformanceData.VideoUploadTime = UploadTime;
+	this->PerformanceData.PeakVideoUploadTime = FMath::Max(this->PerformanceData.PeakVideoUploadTime, UploadTime);
+}
+
 /**
 	Perform the color conversion (if any) and bit copy from the gpu
 */
@@ -887,7 +1567,7 @@ FTextureRHIRef UNDIMediaReceiver::DrawProgressiveVideoFrame(FRHICommandListImmed
 		// Initialize the frame size parameter
 		FIntPoint FrameSize = FIntPoint(Result.xres, Result.yres);
 
-		if (!RenderTarget.IsValid() || !RenderTargetDescriptor.IsValid() ||
+		if (!RenderTargetDescriptor.IsValid() ||
 			RenderTargetDescriptor.GetSize() != FIntVector(FrameSize.X, FrameSize.Y, 0) ||
 			DrawMode != EDrawMode::Progressive)
 		{
@@ -897,44 +1577,24 @@ FTextureRHIRef UNDIMediaReceiver::DrawProgressiveVideoFrame(FRHICommandListImmed
 
 			// Update the shader resource for the 'SourceTexture'
 			// The source texture will be given UYVY data, so make it half-width
-#if (ENGINE_MAJOR_VERSION > 5) || ((ENGINE_MAJOR_VERSION == 5) && (ENGINE_MINOR_VERSION >= 1))
-			const FRHITextureCreateDesc CreateDesc = FRHITextureCreateDesc::Create2D(TEXT("NDIMediaReceiverProgressiveSourceTexture"))
-				.SetExtent(FrameSize.X / 2, FrameSize.Y)
-				.SetFormat(PF_B8G8R8A8)
-				.SetNumMips(1)
-				.SetFlags(ETextureCreateFlags::RenderTargetable | ETextureCreateFlags::Dynamic);
+			CreateSourceTextureRing(TEXT("NDIMediaReceiverProgressiveSourceTexture"), FIntPoint(FrameSize.X / 2, FrameSize.Y), PF_B8G8R8A8, SourceTextureRing);
 
-			SourceTexture = RHICreateTexture(CreateDesc);
-#elif (ENGINE_MAJOR_VERSION == 4) || (ENGINE_MAJOR_VERSION == 5)
-			FRHIResourceCreateInfo CreateInfo(TEXT("NDIMediaReceiverProgressiveSourceTexture"));
-			TRefCountPtr<FRHITexture2D> DummyTexture2DRHI;
-			RHICreateTargetableShaderResource2D(FrameSize.X / 2, FrameSize.Y, PF_B8G8R8A8, 1, TexCreate_Dynamic,
-			                                    TexCreate_RenderTargetable, false, CreateInfo, SourceTexture,
-			                                    DummyTexture2DRHI);
-#else
-			#error "Unsupported engine major version"
-#endif
-
-			// Find a free target-able texture from the render pool
-			GRenderTargetPool.FindFreeElement(RHICmdList, RenderTargetDescriptor, RenderTarget, TEXT("NDIIO"));
+			// A render target of the new size is found in the pool, unless converting into the output target
+			RenderTarget.SafeRelease();
 
 			DrawMode = EDrawMode::Progressive;
 		}
 
-#if ENGINE_MAJOR_VERSION >= 5
-		TargetableTexture = RenderTarget->GetRHI();
-#elif ENGINE_MAJOR_VERSION == 4
-		TargetableTexture = RenderTarget->GetRenderTargetItem().TargetableTexture;
-#else
-		#error "Unsupported engine major version"
-#endif
+		// Convert into the output target when one is set, or else into a render target of our own
+		FConversionTarget Target = GetConversionTarget(RHICmdList, FrameSize);
+		TargetableTexture = Target.Texture;
 
 		// Initialize the Graphics Pipeline State Object
 		FGraphicsPipelineStateInitializer GraphicsPSOInit;
 
 		// Initialize the Render pass with the conversion texture
 		FRHITexture* ConversionTexture = TargetableTexture.GetReference();
-		FRHIRenderPassInfo RPInfo(ConversionTexture, ERenderTargetActions::DontLoad_Store);
+		FRHIRenderPassInfo RPInfo(ConversionTexture, Target.Actions);
 
 		// configure media shaders
 		FGlobalShaderMap* ShaderMap = GetGlobalShaderMap(GMaxRHIFeatureLevel);
@@ -980,9 +1640,12 @@ FTextureRHIRef UNDIMediaReceiver::DrawProgressiveVideoFrame(FRHICommandListImmed
 		// set the stream source
 		RHICmdList.SetStreamSource(0, VertexBuffer, 0);
 
+		// upload into the next texture of the ring, which the GPU is done reading from
+		AdvanceSourceTextureRing();
+
 		// set the texture parameter of the conversion shader
 		FNDIIOShaderUYVYtoBGRAPS::Params Params(SourceTexture, SourceTexture, FrameSize,
-		                                        FVector2D(0, 0), FVector2D(1, 1),
+		                                        Target.UVOffset, Target.UVScale,
 		                                        bPerformsRGBtoLinear ? FNDIIOShaderPS::EColorCorrection::sRGBToLinear : FNDIIOShaderPS::EColorCorrection::None,
 		                                        FVector2D(0.f, 1.f));
 		ConvertShader->SetParameters(RHICmdList, Params);
@@ -991,11 +1654,13 @@ FTextureRHIRef UNDIMediaReceiver::DrawProgressiveVideoFrame(FRHICommandListImmed
 		FUpdateTextureRegion2D Region(0, 0, 0, 0, FrameSize.X/2, FrameSize.Y);
 
 		// Set the Pixel data of the NDI Frame to the SourceTexture
+		uint64 UploadStartCycles = FPlatformTime::Cycles64();
 		RHIUpdateTexture2D(SourceTexture, 0, Region, Result.line_stride_in_bytes, (uint8*&)Result.p_data);
+		RecordVideoUploadTime(UploadStartCycles);
 
 		// begin our drawing
 		{
-			RHICmdList.SetViewport(0, 0, 0.0f, FrameSize.X, FrameSize.Y, 1.0f);
+			RHICmdList.SetViewport(Target.Viewport.Min.X, Target.Viewport.Min.Y, 0.0f, Target.Viewport.Max.X, Target.Viewport.Max.Y, 1.0f);
 			RHICmdList.DrawPrimitive(0, 2, 1);
 		}
 
@@ -1018,7 +1683,7 @@ FTextureRHIRef UNDIMediaReceiver::DrawProgressiveVideoFrameAlpha(FRHICommandList
 		// Initialize the frame size parameter
 		FIntPoint FrameSize = FIntPoint(Result.xres, Result.yres);
 
-		if (!RenderTarget.IsValid() || !RenderTargetDescriptor.IsValid() ||
+		if (!RenderTargetDescriptor.IsValid() ||
 			RenderTargetDescriptor.GetSize() != FIntVector(FrameSize.X, FrameSize.Y, 0) ||
 			DrawMode != EDrawMode::ProgressiveAlpha)
 		{
@@ -1028,57 +1693,25 @@ FTextureRHIRef UNDIMediaReceiver::DrawProgressiveVideoFrameAlpha(FRHICommandList
 
 			// Update the shader resource for the 'SourceTexture'
 			// The source texture will be given UYVY data, so make it half-width
-#if (ENGINE_MAJOR_VERSION > 5) || ((ENGINE_MAJOR_VERSION == 5) && (ENGINE_MINOR_VERSION >= 1))
-			const FRHITextureCreateDesc CreateDesc = FRHITextureCreateDesc::Create2D(TEXT("NDIMediaReceiverProgressiveAlphaSourceTexture"))
-				.SetExtent(FrameSize.X / 2, FrameSize.Y)
-				.SetFormat(PF_B8G8R8A8)
-				.SetNumMips(1)
-				.SetFlags(ETextureCreateFlags::RenderTargetable | ETextureCreateFlags::Dynamic);
-
-			SourceTexture = RHICreateTexture(CreateDesc);
-
-			const FRHITextureCreateDesc CreateAlphaDesc = FRHITextureCreateDesc::Create2D(TEXT("NDIMediaReceiverProgressiveAlphaSourceAlphaTexture"))
-				.SetExtent(FrameSize.X, FrameSize.Y)
-				.SetFormat(PF_A8)
-				.SetNumMips(1)
-				.SetFlags(ETextureCreateFlags::RenderTargetable | ETextureCreateFlags::Dynamic);
-
-			SourceAlphaTexture = RHICreateTexture(CreateAlphaDesc);
-#elif (ENGINE_MAJOR_VERSION == 4) || (ENGINE_MAJOR_VERSION == 5)
-			FRHIResourceCreateInfo CreateInfo(TEXT("NDIMediaReceiverProgressiveAlphaSourceTexture"));
-			TRefCountPtr<FRHITexture2D> DummyTexture2DRHI;
-			RHICreateTargetableShaderResource2D(FrameSize.X/2, FrameSize.Y, PF_B8G8R8A8, 1, TexCreate_Dynamic,
-												TexCreate_RenderTargetable, false, CreateInfo, SourceTexture,
-												DummyTexture2DRHI);
-			FRHIResourceCreateInfo CreateAlphaInfo(TEXT("NDIMediaReceiverProgressiveAlphaSourceAlphaTexture"));
-			TRefCountPtr<FRHITexture2D> DummyAlphaTexture2DRHI;
-			RHICreateTargetableShaderResource2D(FrameSize.X, FrameSize.Y, PF_A8, 1, TexCreate_Dynamic,
-												TexCreate_RenderTargetable, false, CreateAlphaInfo, SourceAlphaTexture,
-												DummyAlphaTexture2DRHI);
-#else
-			#error "Unsupported engine major version"
-#endif
+			CreateSourceTextureRing(TEXT("NDIMediaReceiverProgressiveAlphaSourceTexture"), FIntPoint(FrameSize.X / 2, FrameSize.Y), PF_B8G8R8A8, SourceTextureRing);
+			CreateSourceTextureRing(TEXT("NDIMediaReceiverProgressiveAlphaSourceAlphaTexture"), FIntPoint(FrameSize.X, FrameSize.Y), PF_A8, SourceAlphaTextureRing);
 
-			// Find a free target-able texture from the render pool
-			GRenderTargetPool.FindFreeElement(RHICmdList, RenderTargetDescriptor, RenderTarget, TEXT("NDIIO"));
+			// A render target of the new size is found in the pool, unless converting into the output target
+			RenderTarget.SafeRelease();
 
 			DrawMode = EDrawMode::ProgressiveAlpha;
 		}
 
-#if ENGINE_MAJOR_VERSION >= 5
-		TargetableTexture = RenderTarget->GetRHI();
-#elif ENGINE_MAJOR_VERSION == 4
-		TargetableTexture = RenderTarget->GetRenderTargetItem().TargetableTexture;
-#else
-		#error "Unsupported engine major version"
-#endif
+		// Convert into the output target when one is set, or else into a render target of our own
+		FConversionTarget Target = GetConversionTarget(RHICmdList, FrameSize);
+		TargetableTexture = Target.Texture;
 
 		// Initialize the Graphics Pipeline State Object
 		FGraphicsPipelineStateInitializer GraphicsPSOInit;
 
 		// Initialize the Render pass with the conversion texture
 		FRHITexture* ConversionTexture = TargetableTexture.GetReference();
-		FRHIRenderPassInfo RPInfo(ConversionTexture, ERenderTargetActions::DontLoad_Store);
+		FRHIRenderPassInfo RPInfo(ConversionTexture, Target.Actions);
 
 		// configure media shaders
 		FGlobalShaderMap* ShaderMap = GetGlobalShaderMap(GMaxRHIFeatureLevel);
@@ -1125,10 +1758,13 @@ FTextureRHIRef UNDIMediaReceiver::DrawProgressiveVideoFrameAlpha(FRHICommandList
 		// set the stream source
 		RHICmdList.SetStreamSource(0, VertexBuffer, 0);
 
+		// upload into the next texture of the ring, which the GPU is done reading from
+		AdvanceSourceTextureRing();
+
 		// set the texture parameter of the conversion shader
 		//bool bHasAlpha = (Result.FourCC == NDIlib_FourCC_video_type_UYVA) ? true : false;
 		FNDIIOShaderUYVAtoBGRAPS::Params Params(SourceTexture, SourceAlphaTexture, FrameSize,
-		                                        FVector2D(0, 0), FVector2D(1, 1),
+		                                        Target.UVOffset, Target.UVScale,
 		                                        bPerformsRGBtoLinear ? FNDIIOShaderPS::EColorCorrection::sRGBToLinear : FNDIIOShaderPS::EColorCorrection::None,
 		                                        FVector2D(0.f, 1.f));
 		ConvertShader->SetParameters(RHICmdList, Params);
@@ -1138,12 +1774,14 @@ FTextureRHIRef UNDIMediaReceiver::DrawProgressiveVideoFrameAlpha(FRHICommandList
 		FUpdateTextureRegion2D AlphaRegion(0, 0, 0, 0, FrameSize.X, FrameSize.Y);
 
 		// Set the Pixel data of the NDI Frame to the SourceTexture
+		uint64 UploadStartCycles = FPlatformTime::Cycles64();
 		RHIUpdateTexture2D(SourceTexture, 0, Region, Result.line_stride_in_bytes, (uint8*&)Result.p_data);
 		RHIUpdateTexture2D(SourceAlphaTexture, 0, AlphaRegion, FrameSize.X, ((uint8*&)Result.p_data)+FrameSize.Y*Result.line_stride_in_bytes);
+		RecordVideoUploadTime(UploadStartCycles);
 
 		// begin our drawing
 		{
-			RHICmdList.SetViewport(0, 0, 0.0f, FrameSize.X, FrameSize.Y, 1.0f);
+			RHICmdList.SetViewport(Target.Viewport.Min.X, Target.Viewport.Min.Y, 0.0f, Target.Viewport.Max.X, Target.Viewport.Max.Y, 1.0f);
 			RHICmdList.DrawPrimitive(0, 2, 1);
 		}
 
@@ -1168,7 +1806,7 @@ FTextureRHIRef UNDIMediaReceiver::DrawInterlacedVideoFrame(FRHICommandListImmedi
 		FIntPoint FieldSize = FIntPoint(Result.xres, Result.yres);
 		FIntPoint FrameSize = FIntPoint(Result.xres, Result.yres*2);
 
-		if (!RenderTarget.IsValid() || !RenderTargetDescriptor.IsValid() ||
+		if (!RenderTargetDescriptor.IsValid() ||
 			RenderTargetDescriptor.GetSize() != FIntVector(FrameSize.X, FrameSize.Y, 0) ||
 			DrawMode != EDrawMode::Interlaced)
 		{
@@ -1178,44 +1816,24 @@ FTextureRHIRef UNDIMediaReceiver::DrawInterlacedVideoFrame(FRHICommandListImmedi
 
 			// Update the shader resource for the 'SourceTexture'
 			// The source texture will be given UYVY data, so make it half-width
-#if (ENGINE_MAJOR_VERSION > 5) || ((ENGINE_MAJOR_VERSION == 5) && (ENGINE_MINOR_VERSION >= 1))
-			const FRHITextureCreateDesc CreateDesc = FRHITextureCreateDesc::Create2D(TEXT("NDIMediaReceiverInterlacedSourceTexture"))
-				.SetExtent(FieldSize.X / 2, FieldSize.Y)
-				.SetFormat(PF_B8G8R8A8)
-				.SetNumMips(1)
-				.SetFlags(ETextureCreateFlags::RenderTargetable | ETextureCreateFlags::Dynamic);
-
-			SourceTexture = RHICreateTexture(CreateDesc);
-#elif (ENGINE_MAJOR_VERSION == 4) || (ENGINE_MAJOR_VERSION == 5)
-			FRHIResourceCreateInfo CreateInfo(TEXT("NDIMediaReceiverInterlacedSourceTexture"));
-			TRefCountPtr<FRHITexture2D> DummyTexture2DRHI;
-			RHICreateTargetableShaderResource2D(FieldSize.X/2, FieldSize.Y, PF_B8G8R8A8, 1, TexCreate_Dynamic,
-												TexCreate_RenderTargetable, false, CreateInfo, SourceTexture,
-												DummyTexture2DRHI);
-#else
-			#error "Unsupported engine major version"
-#endif
+			CreateSourceTextureRing(TEXT("NDIMediaReceiverInterlacedSourceTexture"), FIntPoint(FieldSize.X / 2, FieldSize.Y), PF_B8G8R8A8, SourceTextureRing);
 
-			// Find a free target-able texture from the render pool
-			GRenderTargetPool.FindFreeElement(RHICmdList, RenderTargetDescriptor, RenderTarget, TEXT("NDIIO"));
+			// A render target of the new size is found in the pool, unless converting into the output target
+			RenderTarget.SafeRelease();
 
 			DrawMode = EDrawMode::Interlaced;
 		}
 
-#if ENGINE_MAJOR_VERSION >= 5
-		TargetableTexture = RenderTarget->GetRHI();
-#elif ENGINE_MAJOR_VERSION == 4
-		TargetableTexture = RenderTarget->GetRenderTargetItem().TargetableTexture;
-#else
-		#error "Unsupported engine major version"
-#endif
+		// Convert into the output target when one is set, or else into a render target of our own
+		FConversionTarget Target = GetConversionTarget(RHICmdList, FrameSize);
+		TargetableTexture = Target.Texture;
 
 		// Initialize the Graphics Pipeline State Object
 		FGraphicsPipelineStateInitializer GraphicsPSOInit;
 
 		// Initialize the Render pass with the conversion texture
 		FRHITexture* ConversionTexture = TargetableTexture.GetReference();
-		FRHIRenderPassInfo RPInfo(ConversionTexture, ERenderTargetActions::DontLoad_Store);
+		FRHIRenderPassInfo RPInfo(ConversionTexture, Target.Actions);
 
 		// configure media shaders
 		FGlobalShaderMap* ShaderMap = GetGlobalShaderMap(GMaxRHIFeatureLevel);
@@ -1263,9 +1881,12 @@ FTextureRHIRef UNDIMediaReceiver::DrawInterlacedVideoFrame(FRHICommandListImmedi
 		// set the stream source
 		RHICmdList.SetStreamSource(0, VertexBuffer, 0);
 
+		// upload into the next texture of the ring, which the GPU is done reading from
+		AdvanceSourceTextureRing();
+
 		// set the texture parameter of the conversion shader
 		FNDIIOShaderUYVYtoBGRAPS::Params Params(SourceTexture, SourceTexture, FrameSize,
-		                                        FVector2D(0, 0), FVector2D(1, 1),
+		                                        Target.UVOffset, Target.UVScale,
 		                                        bPerformsRGBtoLinear ? FNDIIOShaderPS::EColorCorrection::sRGBToLinear : FNDIIOShaderPS::EColorCorrection::None,
 		                                        FVector2D(0.f, 1.f));
 		ConvertShader->SetParameters(RHICmdList, Params);
@@ -1274,11 +1895,13 @@ FTextureRHIRef UNDIMediaReceiver::DrawInterlacedVideoFrame(FRHICommandListImmedi
 		FUpdateTextureRegion2D Region(0, 0, 0, 0, FieldSize.X/2, FieldSize.Y);
 
 		// Set the Pixel data of the NDI Frame to the SourceTexture
+		uint64 UploadStartCycles = FPlatformTime::Cycles64();
 		RHIUpdateTexture2D(SourceTexture, 0, Region, Result.line_stride_in_bytes, (uint8*&)Result.p_data);
+		RecordVideoUploadTime(UploadStartCycles);
 
 		// begin our drawing
 		{
-			RHICmdList.SetViewport(0, 0, 0.0f, FrameSize.X, FrameSize.Y, 1.0f);
+			RHICmdList.SetViewport(Target.Viewport.Min.X, Target.Viewport.Min.Y, 0.0f, Target.Viewport.Max.X, Target.Viewport.Max.Y, 1.0f);
 			RHICmdList.DrawPrimitive(0, 2, 1);
 		}
 
@@ -1302,7 +1925,7 @@ FTextureRHIRef UNDIMediaReceiver::DrawInterlacedVideoFrameAlpha(FRHICommandListI
 		FIntPoint FieldSize = FIntPoint(Result.xres, Result.yres);
 		FIntPoint FrameSize = FIntPoint(Result.xres, Result.yres*2);
 
-		if (!RenderTarget.IsValid() || !RenderTargetDescriptor.IsValid() ||
+		if (!RenderTargetDescriptor.IsValid() ||
 			RenderTargetDescriptor.GetSize() != FIntVector(FrameSize.X, FrameSize.Y, 0) ||
 			DrawMode != EDrawMode::InterlacedAlpha)
 		{
@@ -1312,57 +1935,25 @@ FTextureRHIRef UNDIMediaReceiver::DrawInterlacedVideoFrameAlpha(FRHICommandListI
 
 			// Update the shader resource for the 'SourceTexture'
 			// The source texture will be given UYVY data, so make it half-width
-#if (ENGINE_MAJOR_VERSION > 5) || ((ENGINE_MAJOR_VERSION == 5) && (ENGINE_MINOR_VERSION >= 1))
-			const FRHITextureCreateDesc CreateDesc = FRHITextureCreateDesc::Create2D(TEXT("NDIMediaReceiverInterlacedAlphaSourceTexture"))
-				.SetExtent(FieldSize.X / 2, FieldSize.Y)
-				.SetFormat(PF_B8G8R8A8)
-				.SetNumMips(1)
-				.SetFlags(ETextureCreateFlags::RenderTargetable | ETextureCreateFlags::Dynamic);
-
-			SourceTexture = RHICreateTexture(CreateDesc);
-
-			const FRHITextureCreateDesc CreateAlphaDesc = FRHITextureCreateDesc::Create2D(TEXT("NDIMediaReceiverInterlacedAlphaSourceAlphaTexture"))
-				.SetExtent(FieldSize.X, FieldSize.Y)
-				.SetFormat(PF_A8)
-				.SetNumMips(1)
-				.SetFlags(ETextureCreateFlags::RenderTargetable | ETextureCreateFlags::Dynamic);
-
-			SourceAlphaTexture = RHICreateTexture(CreateAlphaDesc);
-#elif (ENGINE_MAJOR_VERSION == 4) || (ENGINE_MAJOR_VERSION == 5)
-			FRHIResourceCreateInfo CreateInfo(TEXT("NDIMediaReceiverInterlacedAlphaSourceTexture"));
-			TRefCountPtr<FRHITexture2D> DummyTexture2DRHI;
-			RHICreateTargetableShaderResource2D(FieldSize.X/2, FieldSize.Y, PF_B8G8R8A8, 1, TexCreate_Dynamic,
-												TexCreate_RenderTargetable, false, CreateInfo, SourceTexture,
-												DummyTexture2DRHI);
-			FRHIResourceCreateInfo CreateAlphaInfo(TEXT("NDIMediaReceiverInterlacedAlphaSourceAlphaTexture"));
-			TRefCountPtr<FRHITexture2D> DummyAlphaTexture2DRHI;
-			RHICreateTargetableShaderResource2D(FieldSize.X, FieldSize.Y, PF_A8, 1, TexCreate_Dynamic,
-												TexCreate_RenderTargetable, false, CreateAlphaInfo, SourceAlphaTexture,
-												DummyAlphaTexture2DRHI);
-#else
-			#error "Unsupported engine major version"
-#endif
+			CreateSourceTextureRing(TEXT("NDIMediaReceiverInterlacedAlphaSourceTexture"), FIntPoint(FieldSize.X / 2, FieldSize.Y), PF_B8G8R8A8, SourceTextureRing);
+			CreateSourceTextureRing(TEXT("NDIMediaReceiverInterlacedAlphaSourceAlphaTexture"), FIntPoint(FieldSize.X, FieldSize.Y), PF_A8, SourceAlphaTextureRing);
 
-			// Find a free target-able texture from the render pool
-			GRenderTargetPool.FindFreeElement(RHICmdList, RenderTargetDescriptor, RenderTarget, TEXT("NDIIO"));
+			// A render target of the new size is found in the pool, unless converting into the output target
+			RenderTarget.SafeRelease();
 
 			DrawMode = EDrawMode::InterlacedAlpha;
 		}
 
-#if ENGINE_MAJOR_VERSION >= 5
-		TargetableTexture = RenderTarget->GetRHI();
-#elif ENGINE_MAJOR_VERSION == 4
-		TargetableTexture = RenderTarget->GetRenderTargetItem().TargetableTexture;
-#else
-		#error "Unsupported engine major version"
-#endif
+		// Convert into the output target when one is set, or else into a render target of our own
+		FConversionTarget Target = GetConversionTarget(RHICmdList, FrameSize);
+		TargetableTexture = Target.Texture;
 
 		// Initialize the Graphics Pipeline State Object
 		FGraphicsPipelineStateInitializer GraphicsPSOInit;
 
 		// Initialize the Render pass with the conversion texture
 		FRHITexture* ConversionTexture = TargetableTexture.GetReference();
-		FRHIRenderPassInfo RPInfo(ConversionTexture, ERenderTargetActions::DontLoad_Store);
+		FRHIRenderPassInfo RPInfo(ConversionTexture, Target.Actions);
 
 		// configure media shaders
 		FGlobalShaderMap* ShaderMap = GetGlobalShaderMap(GMaxRHIFeatureLevel);
@@ -1410,9 +2001,12 @@ FTextureRHIRef UNDIMediaReceiver::DrawInterlacedVideoFrameAlpha(FRHICommandListI
 		// set the stream source
 		RHICmdList.SetStreamSource(0, VertexBuffer, 0);
 
+		// upload into the next texture of the ring, which the GPU is done reading from
+		AdvanceSourceTextureRing();
+
 		// set the texture parameter of the conversion shader
 		FNDIIOShaderUYVAtoBGRAPS::Params Params(SourceTexture, SourceAlphaTexture, FrameSize,
-		                                        FVector2D(0, 0), FVector2D(1, 1),
+		                                        Target.UVOffset, Target.UVScale,
 		                                        bPerformsRGBtoLinear ? FNDIIOShaderPS::EColorCorrection::sRGBToLinear : FNDIIOShaderPS::EColorCorrection::None,
 		                                        FVector2D(0.f, 1.f));
 		ConvertShader->SetParameters(RHICmdList, Params);
@@ -1422,12 +2016,14 @@ FTextureRHIRef UNDIMediaReceiver::DrawInterlacedVideoFrameAlpha(FRHICommandListI
 		FUpdateTextureRegion2D AlphaRegion(0, 0, 0, 0, FieldSize.X, FieldSize.Y);
 
 		// Set the Pixel data of the NDI Frame to the SourceTexture
+		uint64 UploadStartCycles = FPlatformTime::Cycles64();
 		RHIUpdateTexture2D(SourceTexture, 0, Region, Result.line_stride_in_bytes, (uint8*&)Result.p_data);
 		RHIUpdateTexture2D(SourceAlphaTexture, 0, AlphaRegion, FieldSize.X, ((uint8*&)Result.p_data)+FieldSize.Y*Result.line_stride_in_bytes);
+		RecordVideoUploadTime(UploadStartCycles);
 
 		// begin our drawing
 		{
-			RHICmdList.SetViewport(0, 0, 0.0f, FrameSize.X, FrameSize.Y, 1.0f);
+			RHICmdList.SetViewport(Target.Viewport.Min.X, Target.Viewport.Min.Y, 0.0f, Target.Viewport.Max.X, Target.Viewport.Max.Y, 1.0f);
 			RHICmdList.DrawPrimitive(0, 2, 1);
 		}
 
@@ -1477,6 +2073,155 @@ const bool UNDIMediaReceiver::GetIsCurrentlyConnected() const
 		return false;
 }
 
+/**
+	Returns the health of the connection to the source, as last found by the watchdog
+*/
+ENDIReceiverHealth UNDIMediaReceiver::GetHealth() const
+{
+	return this->Health;
+}
+
+/**
+	Returns whether video is captured from the source, given the receive profile and the connection settings
+*/
+bool UNDIMediaReceiver::ReceivesVideo() const
+{
+	return HasVideoProfile() && (this->ConnectionInformation.bMuteVideo == false);
+}
+
+/**
+	Returns whether audio is captured from the source, given the receive profile and the connection settings
+*/
+bool UNDIMediaReceiver::ReceivesAudio() const
+{
+	return (ReceiveProfile == ENDIReceiveProfile::Full || ReceiveProfile == ENDIReceiveProfile::AudioOnly) &&
+		   (this->ConnectionInformation.bMuteAudio == false);
+}
+
+/**
+	Returns the bandwidth to ask the source for, which is never more than the receive profile needs
+*/
+NDIlib_recv_bandwidth_e UNDIMediaReceiver::GetReceiveBandwidth() const
+{
+	NDIlib_recv_bandwidth_e bandwidth = this->ConnectionInformation;
+
+	if (ReceiveProfile == ENDIReceiveProfile::MetadataOnly)
+		bandwidth = NDIlib_recv_bandwidth_metadata_only;
+	else if ((ReceiveProfile == ENDIReceiveProfile::AudioOnly) && (bandwidth != NDIlib_recv_bandwidth_metadata_only))
+		bandwidth = NDIlib_recv_bandwidth_audio_only;
+
+	return bandwidth;
+}
+
+/**
+	Looks at the connection a few times a second. A receiver which has had no connection to its source for the
+	connection timeout, or has received nothing from it for the frame timeout, reconnects. The delay between attempts
+	doubles from the minimum to the maximum reconnect delay, with some jitter so that the receivers of a source
+	which has restarted do not all reconnect at once.
+*/
+void UNDIMediaReceiver::UpdateWatchdog()
+{
+	if ((bEnableWatchdog == false) || (p_receive_instance == nullptr) || (this->ConnectionInformation.IsValid() == false))
+		return;
+
+	const uint64 NowCycles = FPlatformTime::Cycles64();
+	if (NowCycles < NextWatchdogCycles)
+		return;
+
+	const double SecondsPerCycle = FPlatformTime::GetSecondsPerCycle64();
+	NextWatchdogCycles = NowCycles + (uint64)(0.25 / SecondsPerCycle);
+
+	if (NDIlib_recv_get_no_connections(p_receive_instance) > 0)
+		LastConnectedCycles = NowCycles;
+
+	const double ConnectionAge = (NowCycles - FMath::Min(LastConnectedCycles, NowCycles)) * SecondsPerCycle;
+	const double FrameAge = (NowCycles - FMath::Min(LastMediaCycles.load(), NowCycles)) * SecondsPerCycle;
+	this->PerformanceData.LastFrameAge = (float)FrameAge;
+
+	if (ConnectionAge > ConnectionTimeout)
+		SetHealth(ENDIReceiverHealth::Disconnected);
+	else if ((FrameTimeout > 0.f) && (FrameAge > FrameTimeout))
+		SetHealth(ENDIReceiverHealth::Stalled);
+	else
+		SetHealth(ENDIReceiverHealth::Healthy);
+
+	if (this->Health == ENDIReceiverHealth::Healthy)
+	{
+		ReconnectAttempts = 0;
+		NextReconnectCycles = 0;
+		return;
+	}
+
+	if (NowCycles < NextReconnectCycles)
+		return;
+
+	ReconnectToSource();
+
+	double Delay = FMath::Min(MinReconnectDelay * FMath::Pow(2.0, (double)FMath::Min(ReconnectAttempts, 16)), (double)FMath::Max(MaxReconnectDelay, MinReconnectDelay));
+	Delay *= FMath::FRandRange(0.75f, 1.25f);
+
+	NextReconnectCycles = NowCycles + (uint64)(Delay / SecondsPerCycle);
+	++ReconnectAttempts;
+	++this->PerformanceData.Reconnects;
+}
+
+/**
+	Remakes the connection to the source, looking it up through the finder first, since a source which has
+	restarted can come back at another address
+*/
+void UNDIMediaReceiver::ReconnectToSource()
+{
+	FScopeLock RenderLock(&RenderSyncContext);
+	FScopeLock AudioLock(&AudioSyncContext);
+	FScopeLock MetadataLock(&MetadataSyncContext);
+
+	// The connection information is read on the game thread without the locks, so the address found is only used
+	// for this connection rather than stored
+	FString Url = this->ConnectionInformation.Url;
+
+	const FString NDIName = this->ConnectionInformation.GetNDIName();
+	if (!NDIName.IsEmpty())
+	{
+		for (const FNDIConnectionInformation& Source : FNDIFinderService::GetNetworkSourceCollection())
+		{
+			if ((Source.GetNDIName() == NDIName) && !Source.Url.IsEmpty())
+			{
+				Url = Source.Url;
+				break;
+			}
+		}
+	}
+
+	StartConnectionAt(Url);
+}
+
+/**
+	Gives the watchdog a fresh start, for a source which has just been connected to
+*/
+void UNDIMediaReceiver::ResetWatchdog()
+{
+	const uint64 NowCycles = FPlatformTime::Cycles64();
+
+	LastMediaCycles = NowCycles;
+	LastConnectedCycles = NowCycles;
+	NextReconnectCycles = 0;
+	ReconnectAttempts = 0;
+}
+
+void UNDIMediaReceiver::SetHealth(ENDIReceiverHealth NewHealth)
+{
+	if (NewHealth == this->Health)
+		return;
+
+	this->Health = NewHealth;
+
+	AsyncTask(ENamedThreads::GameThread, [WeakThis = TWeakObjectPtr<UNDIMediaReceiver>(this), NewHealth]() {
+		// Broadcast the event
+		if (UNDIMediaReceiver* Receiver = WeakThis.Get())
+			Receiver->OnReceiverHealthChanged.Broadcast(Receiver, NewHealth);
+	});
+}
+
 /**
 	Returns the current connection information of the connected source
 */
@@ -1600,6 +2345,21 @@ FTextureResource* UNDIMediaReceiver::GetInternalVideoTextureResource() const
 	return nullptr;
 }
 
+FTextureResource* UNDIMediaReceiver::GetOutputTargetResource() const
+{
+	if(IsValid(this->OutputTarget))
+#if ENGINE_MAJOR_VERSION == 5
+		return this->OutputTarget->GetResource();
+#elif ENGINE_MAJOR_VERSION == 4
+		return this->OutputTarget->Resource;
+#else
+		#error "Unsupported engine major version"
+		return nullptr;
+#endif
+
+	return nullptr;
+}
+
 
 #if WITH_EDITORONLY_DATA
 
@@ -0,0 +1,270 @@
+/*
+	Copyright (C) 2023 Vizrt NDI AB. All rights reserved.
+
+	This file and it's use within a Product is bound by the terms of NDI SDK license that was provided
+	as part of the NDI SDK. For more information, please review the license and the NDI SDK documentation.
+*/
+
+#include <Objects/Media/NDIMediaReceiverBus.h>
+#include <Async/Async.h>
+
+#include <string>
+
+/**
+	Connects the standby sources
+*/
+void UNDIMediaReceiverBus::Initialize()
+{
+	ChangeStandbySources(TArray<FNDIConnectionInformation>(this->StandbySources));
+}
+
+/**
+	Changes the sources kept in standby. Sources which were already in standby keep their connection.
+*/
+void UNDIMediaReceiverBus::ChangeStandbySources(const TArray<FNDIConnectionInformation>& InStandbySources)
+{
+	TArray<TSharedRef<FStandbyConnection, ESPMode::ThreadSafe>> OldStandbyConnections = MoveTemp(StandbyConnections);
+	StandbyConnections.Reset();
+
+	for (const FNDIConnectionInformation& Source : InStandbySources)
+	{
+		int32 OldIndex = OldStandbyConnections.IndexOfByPredicate([&](const TSharedRef<FStandbyConnection, ESPMode::ThreadSafe>& Standby)
+		{
+			return IsSameSource(Standby->ConnectionInformation, Source);
+		});
+
+		if (OldIndex != INDEX_NONE)
+		{
+			StandbyConnections.Add(OldStandbyConnections[OldIndex]);
+			OldStandbyConnections.RemoveAt(OldIndex);
+		}
+		else
+		{
+			TSharedRef<FStandbyConnection, ESPMode::ThreadSafe> Standby = MakeShared<FStandbyConnection, ESPMode::ThreadSafe>();
+			Standby->ConnectionInformation = Source;
+			StandbyConnections.Add(Standby);
+
+			ConnectStandby(Standby);
+		}
+	}
+
+	for (const auto& Standby : OldStandbyConnections)
+	{
+		DisconnectStandby(Standby);
+	}
+
+	this->StandbySources = InStandbySources;
+}
+
+/**
+	Cuts the program receiver to the standby source at the given index
+*/
+bool UNDIMediaReceiverBus::Cut(int32 Index)
+{
+	if (!IsValid(ProgramReceiver) || !StandbySources.IsValidIndex(Index))
+		return false;
+
+	return CutToSource(StandbySources[Index]);
+}
+
+/**
+	Cuts the program receiver to the given source, from its standby connection if it is one of the standby sources
+*/
+bool UNDIMediaReceiverBus::CutToSource(const FNDIConnectionInformation& InConnectionInformation)
+{
+	if (!IsValid(ProgramReceiver) || !InConnectionInformation.IsValid())
+		return false;
+
+	const TSharedRef<FStandbyConnection, ESPMode::ThreadSafe>* Standby = StandbyConnections.FindByPredicate([&](const TSharedRef<FStandbyConnection, ESPMode::ThreadSafe>& Connection)
+	{
+		return IsSameSource(Connection->ConnectionInformation, InConnectionInformation);
+	});
+
+	NDIlib_recv_instance_t receive_instance = nullptr;
+	NDIlib_framesync_instance_t framesync_instance = nullptr;
+
+	if (Standby != nullptr)
+	{
+		FScopeLock Lock(&(*Standby)->SyncContext);
+
+		receive_instance = (*Standby)->p_receive_instance;
+		framesync_instance = (*Standby)->p_framesync_instance;
+		(*Standby)->p_receive_instance = nullptr;
+		(*Standby)->p_framesync_instance = nullptr;
+	}
+
+	if (framesync_instance != nullptr)
+	{
+		// The standby connection already holds a frame, so the program receiver displays it on the next frame,
+		// and moves up to the bandwidth of the source in the background
+		ProgramReceiver->AdoptConnection(InConnectionInformation, StandbyBandwidth, receive_instance, framesync_instance);
+		++PerformanceData.Cuts;
+	}
+	else
+	{
+		UNDIMediaReceiver::DestroyConnectionAsync(receive_instance, nullptr);
+
+		ProgramReceiver->ChangeConnection(InConnectionInformation);
+		++PerformanceData.ColdCuts;
+	}
+
+	// Keep the source in standby, ready for the next time it is cut to
+	if (Standby != nullptr)
+		ConnectStandby(*Standby);
+
+	return true;
+}
+
+/**
+	Disconnects the standby sources
+*/
+void UNDIMediaReceiverBus::Shutdown()
+{
+	for (const auto& Standby : StandbyConnections)
+	{
+		DisconnectStandby(Standby);
+	}
+
+	StandbyConnections.Reset();
+}
+
+/**
+	Returns the current cost of the standby connections, and the latency of the last cut
+*/
+FNDIReceiverBusPerformanceData UNDIMediaReceiverBus::GetPerformanceData()
+{
+	PerformanceData.StandbyConnections = 0;
+	PerformanceData.StandbyVideoFrames = 0;
+	PerformanceData.StandbyVideoDataRate = 0;
+
+	for (const auto& Standby : StandbyConnections)
+	{
+		FScopeLock Lock(&Standby->SyncContext);
+
+		if (Standby->p_framesync_instance == nullptr)
+			continue;
+
+		++PerformanceData.StandbyConnections;
+
+		NDIlib_recv_performance_t stable_performance;
+		NDIlib_recv_performance_t dropped_performance;
+		NDIlib_recv_get_performance(Standby->p_receive_instance, &stable_performance, &dropped_performance);
+		PerformanceData.StandbyVideoFrames += stable_performance.video_frames;
+
+		// The frame sync hands out the frame it holds without copying it
+		NDIlib_video_frame_v2_t video_frame;
+		NDIlib_framesync_capture_video(Standby->p_framesync_instance, &video_frame, NDIlib_frame_format_type_progressive);
+		if ((video_frame.p_data != nullptr) && (video_frame.frame_rate_D > 0))
+		{
+			PerformanceData.StandbyVideoDataRate += (int64)video_frame.line_stride_in_bytes * video_frame.yres *
+													video_frame.frame_rate_N / video_frame.frame_rate_D;
+		}
+		NDIlib_framesync_free_video(Standby->p_framesync_instance, &video_frame);
+	}
+
+	if (IsValid(ProgramReceiver) && ((PerformanceData.Cuts + PerformanceData.ColdCuts) > 0))
+		PerformanceData.CutLatency = ProgramReceiver->GetPerformanceData().TimeToFirstFrame;
+
+	return PerformanceData;
+}
+
+/**
+   Called before destroying the object.  This is called immediately upon deciding to destroy the object,
+   to allow the object to begin an asynchronous cleanup process.
+ */
+void UNDIMediaReceiverBus::BeginDestroy()
+{
+	this->Shutdown();
+
+	Super::BeginDestroy();
+}
+
+/**
+	(Re-)connects a source in standby. Creating the receiver blocks while the connection is negotiated, so it is done
+	on a worker thread.
+*/
+void UNDIMediaReceiverBus::ConnectStandby(const TSharedRef<FStandbyConnection, ESPMode::ThreadSafe>& Standby)
+{
+	DisconnectStandby(Standby);
+
+	if (!Standby->ConnectionInformation.IsValid())
+		return;
+
+	FNDIConnectionInformation StandbyInformation = Standby->ConnectionInformation;
+	StandbyInformation.Bandwidth = StandbyBandwidth;
+
+	NDIlib_recv_create_v3_t settings;
+	settings.allow_video_fields = true;
+	settings.bandwidth = StandbyInformation;
+	settings.color_format = NDIlib_recv_color_format_fastest;
+
+	std::string SourceNameStr(TCHAR_TO_UTF8(*StandbyInformation.GetNDIName()));
+	std::string UrlStr(TCHAR_TO_UTF8(*StandbyInformation.Url));
+
+	uint32 Generation = 0;
+	{
+		FScopeLock Lock(&Standby->SyncContext);
+		Generation = Standby->Generation;
+	}
+
+	AsyncTask(ENamedThreads::AnyBackgroundThreadNormalTask, [Standby, Generation, settings, SourceNameStr, UrlStr]()
+	{
+		NDIlib_source_t connection;
+		connection.p_ndi_name = SourceNameStr.c_str();
+		connection.p_url_address = UrlStr.c_str();
+
+		NDIlib_recv_instance_t receive_instance = NDIlib_recv_create_v3(&settings);
+		if (receive_instance == nullptr)
+			return;
+
+		NDIlib_recv_connect(receive_instance, &connection);
+		NDIlib_framesync_instance_t framesync_instance = NDIlib_framesync_create(receive_instance);
+
+		{
+			FScopeLock Lock(&Standby->SyncContext);
+
+			// Hand the connection over, unless the source has been disconnected or reconnected in the meantime
+			if (Standby->Generation == Generation)
+			{
+				Standby->p_receive_instance = receive_instance;
+				Standby->p_framesync_instance = framesync_instance;
+				return;
+			}
+		}
+
+		if (framesync_instance != nullptr)
+			NDIlib_framesync_destroy(framesync_instance);
+		NDIlib_recv_destroy(receive_instance);
+	});
+}
+
+/**
+	Disconnects a source in standby, and forgets any connection still being established for it. The connection is
+	destroyed on a worker thread, as the receiver does, so that the game thread does not wait on the NDI SDK.
+*/
+void UNDIMediaReceiverBus::DisconnectStandby(const TSharedRef<FStandbyConnection, ESPMode::ThreadSafe>& Standby)
+{
+	NDIlib_recv_instance_t receive_instance = nullptr;
+	NDIlib_framesync_instance_t framesync_instance = nullptr;
+	{
+		FScopeLock Lock(&Standby->SyncContext);
+
+		++Standby->Generation;
+
+		receive_instance = Standby->p_receive_instance;
+		framesync_instance = Standby->p_framesync_instance;
+		Standby->p_receive_instance = nullptr;
+		Standby->p_framesync_instance = nullptr;
+	}
+
+	UNDIMediaReceiver::DestroyConnectionAsync(receive_instance, framesync_instance);
+}
+
+/**
+	Returns whether both describe the same source, whatever the bandwidth they are received at
+*/
+bool UNDIMediaReceiverBus::IsSameSource(const FNDIConnectionInformation& A, const FNDIConnectionInformation& B)
+{
+	return (A.SourceName == B.SourceName) && (A.MachineName == B.MachineName) &&
+		   (A.StreamName == B.StreamName) && (A.Url == B.Url);
+}
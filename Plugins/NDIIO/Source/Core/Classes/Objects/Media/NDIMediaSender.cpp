@@ -17,8 +17,11 @@
 #include <MediaShaders.h>
 
 #include <Async/Async.h>
+#include <Math/Float16Color.h>
 
 #include <Misc/EngineVersionComparison.h>
+#include <Misc/ScopeExit.h>
+#include <HAL/PlatformTLS.h>
 
 #include "NDIShaders.h"
 
@@ -130,6 +133,33 @@ static FBufferRHIRef CreateAlphaOddVertexBuffer(FRHICommandListImmediate& RHICmd
 	return VertexBufferRHI;
 }
 
+static FBufferRHIRef CreatePlaneVertexBuffer(FRHICommandListImmediate& RHICmdList, int32 PlaneIndex, int32 NumPlanes)
+{
+	FRHIResourceCreateInfo CreateInfo(TEXT("VertexBufferRHI"));
+	FBufferRHIRef VertexBufferRHI = RHICmdList.CreateVertexBuffer(sizeof(FMediaElementVertex) * 4, BUF_Volatile, CreateInfo);
+
+	void* VoidPtr = RHICmdList.LockBuffer(VertexBufferRHI, 0, sizeof(FMediaElementVertex) * 4, RLM_WriteOnly);
+
+	// Each plane is a horizontal band of the conversion texture, from top to bottom
+	float Top    = 1.0f - (2.0f * PlaneIndex) / NumPlanes;
+	float Bottom = 1.0f - (2.0f * (PlaneIndex + 1)) / NumPlanes;
+
+	FMediaElementVertex* Vertices = (FMediaElementVertex*)VoidPtr;
+	Vertices[0].Position.Set(-1.0f, Top,    1.0f, 1.0f); // Top Left
+	Vertices[1].Position.Set( 1.0f, Top,    1.0f, 1.0f); // Top Right
+	Vertices[2].Position.Set(-1.0f, Bottom, 1.0f, 1.0f); // Bottom Left
+	Vertices[3].Position.Set( 1.0f, Bottom, 1.0f, 1.0f); // Bottom Right
+
+	Vertices[0].TextureCoordinate.Set(0.0f, 0.0f);
+	Vertices[1].TextureCoordinate.Set(1.0f, 0.0f);
+	Vertices[2].TextureCoordinate.Set(0.0f, 1.0f);
+	Vertices[3].TextureCoordinate.Set(1.0f, 1.0f);
+
+	RHICmdList.UnlockBuffer(VertexBufferRHI);
+
+	return VertexBufferRHI;
+}
+
 #elif ENGINE_MAJOR_VERSION == 5
 
 static FBufferRHIRef CreateColorVertexBuffer(FRHICommandListImmediate& RHICmdList, const FIntPoint& FitFrameSize, const FIntPoint& DrawFrameSize, bool OutputAlpha)
@@ -231,6 +261,33 @@ static FBufferRHIRef CreateAlphaOddVertexBuffer(FRHICommandListImmediate& RHICmd
 	return VertexBufferRHI;
 }
 
+static FBufferRHIRef CreatePlaneVertexBuffer(FRHICommandListImmediate& RHICmdList, int32 PlaneIndex, int32 NumPlanes)
+{
+	FRHIResourceCreateInfo CreateInfo(TEXT("VertexBufferRHI"));
+	FBufferRHIRef VertexBufferRHI = RHICreateVertexBuffer(sizeof(FMediaElementVertex) * 4, BUF_Volatile, CreateInfo);
+
+	void* VoidPtr = RHILockBuffer(VertexBufferRHI, 0, sizeof(FMediaElementVertex) * 4, RLM_WriteOnly);
+
+	// Each plane is a horizontal band of the conversion texture, from top to bottom
+	float Top    = 1.0f - (2.0f * PlaneIndex) / NumPlanes;
+	float Bottom = 1.0f - (2.0f * (PlaneIndex + 1)) / NumPlanes;
+
+	FMediaElementVertex* Vertices = (FMediaElementVertex*)VoidPtr;
+	Vertices[0].Position.Set(-1.0f, Top,    1.0f, 1.0f); // Top Left
+	Vertices[1].Position.Set( 1.0f, Top,    1.0f, 1.0f); // Top Right
+	Vertices[2].Position.Set(-1.0f, Bottom, 1.0f, 1.0f); // Bottom Left
+	Vertices[3].Position.Set( 1.0f, Bottom, 1.0f, 1.0f); // Bottom Right
+
+	Vertices[0].TextureCoordinate.Set(0.0f, 0.0f);
+	Vertices[1].TextureCoordinate.Set(1.0f, 0.0f);
+	Vertices[2].TextureCoordinate.Set(0.0f, 1.0f);
+	Vertices[3].TextureCoordinate.Set(1.0f, 1.0f);
+
+	RHIUnlockBuffer(VertexBufferRHI);
+
+	return VertexBufferRHI;
+}
+
 #elif ENGINE_MAJOR_VERSION == 4
 
 static FVertexBufferRHIRef CreateColorVertexBuffer(const FIntPoint& FitFrameSize, const FIntPoint& DrawFrameSize, bool OutputAlpha)
@@ -332,11 +389,190 @@ static FVertexBufferRHIRef CreateAlphaOddVertexBuffer(const FIntPoint& FitFrameS
 	return VertexBufferRHI;
 }
 
+static FVertexBufferRHIRef CreatePlaneVertexBuffer(int32 PlaneIndex, int32 NumPlanes)
+{
+	FRHIResourceCreateInfo CreateInfo;
+	FVertexBufferRHIRef VertexBufferRHI = RHICreateVertexBuffer(sizeof(FMediaElementVertex) * 4, BUF_Volatile, CreateInfo);
+
+	void* VoidPtr = RHILockVertexBuffer(VertexBufferRHI, 0, sizeof(FMediaElementVertex) * 4, RLM_WriteOnly);
+
+	// Each plane is a horizontal band of the conversion texture, from top to bottom
+	float Top    = 1.0f - (2.0f * PlaneIndex) / NumPlanes;
+	float Bottom = 1.0f - (2.0f * (PlaneIndex + 1)) / NumPlanes;
+
+	FMediaElementVertex* Vertices = (FMediaElementVertex*)VoidPtr;
+	Vertices[0].Position.Set(-1.0f, Top,    1.0f, 1.0f); // Top Left
+	Vertices[1].Position.Set( 1.0f, Top,    1.0f, 1.0f); // Top Right
+	Vertices[2].Position.Set(-1.0f, Bottom, 1.0f, 1.0f); // Bottom Left
+	Vertices[3].Position.Set( 1.0f, Bottom, 1.0f, 1.0f); // Bottom Right
+
+	Vertices[0].TextureCoordinate.Set(0.0f, 0.0f);
+	Vertices[1].TextureCoordinate.Set(1.0f, 0.0f);
+	Vertices[2].TextureCoordinate.Set(0.0f, 1.0f);
+	Vertices[3].TextureCoordinate.Set(1.0f, 1.0f);
+
+	RHIUnlockVertexBuffer(VertexBufferRHI);
+
+	return VertexBufferRHI;
+}
+
+#else
+	#error "Unsupported engine major version"
+#endif
+
+
+/**
+	Draws one conversion pass into the band of the conversion texture covered by VertexBuffer,
+	such as one plane of the planar 16 bits formats (P216/PA16)
+*/
+template<typename PixelShaderType, typename VertexBufferType>
+static void DrawConversionPass(FRHICommandListImmediate& RHICmdList, FRHITexture* ConversionTexture, ERenderTargetActions Actions,
+                             const VertexBufferType& VertexBuffer, FNDIIOShaderPS::Params& Params,
+                             const TRefCountPtr<FRHITexture2D>& ReleaseTexture)
+{
+	FGlobalShaderMap* ShaderMap = GetGlobalShaderMap(GMaxRHIFeatureLevel);
+
+	TShaderMapRef<FNDIIOShaderVS> VertexShader(ShaderMap);
+	TShaderMapRef<PixelShaderType> ConvertShader(ShaderMap);
+
+	FGraphicsPipelineStateInitializer GraphicsPSOInit;
+
+	FRHIRenderPassInfo RPInfo(ConversionTexture, Actions);
+	RHICmdList.BeginRenderPass(RPInfo, TEXT("NDI Send Scaling Conversion"));
+
+	RHICmdList.ApplyCachedRenderTargets(GraphicsPSOInit);
+	GraphicsPSOInit.DepthStencilState = TStaticDepthStencilState<false, CF_Always>::GetRHI();
+	GraphicsPSOInit.RasterizerState = TStaticRasterizerState<>::GetRHI();
+	GraphicsPSOInit.BlendState = TStaticBlendStateWriteMask<CW_RGBA, CW_NONE, CW_NONE, CW_NONE, CW_NONE,
+	                                                        CW_NONE, CW_NONE, CW_NONE>::GetRHI();
+	GraphicsPSOInit.BoundShaderState.VertexDeclarationRHI = GMediaVertexDeclaration.VertexDeclarationRHI;
+	GraphicsPSOInit.BoundShaderState.VertexShaderRHI = VertexShader.GetVertexShader();
+	GraphicsPSOInit.BoundShaderState.PixelShaderRHI = ConvertShader.GetPixelShader();
+	GraphicsPSOInit.PrimitiveType = PT_TriangleStrip;
+
+#if ENGINE_MAJOR_VERSION >= 5
+	SetGraphicsPipelineState(RHICmdList, GraphicsPSOInit, 0);
+#elif ENGINE_MAJOR_VERSION == 4
+	SetGraphicsPipelineState(RHICmdList, GraphicsPSOInit);
 #else
 	#error "Unsupported engine major version"
 #endif
 
+	RHICmdList.SetStreamSource(0, VertexBuffer, 0);
+
+	ConvertShader->SetParameters(RHICmdList, Params);
+
+	RHICmdList.DrawPrimitive(0, 2, 1);
+
+	// Release the reference to the source texture from the shader, as it may be the viewport's backbuffer
+	TRefCountPtr<FRHITexture2D> InputTarget = Params.InputTarget;
+	Params.InputTarget = ReleaseTexture;
+	ConvertShader->SetParameters(RHICmdList, Params);
+	Params.InputTarget = InputTarget;
+
+	RHICmdList.EndRenderPass();
+}
+
+
+
+
+
+/**
+	Converts a line of BGRA8 pixels to UYVY, and to the alpha plane of UYVA if DstAlpha is set.
+	Each pixel is converted with one 4-wide matrix multiply giving (Y, Cb, Cr, A) at once,
+	using the same BT.709 video range coefficients as the NDIIOBGRAtoUYVYPS shader.
+*/
+static void ConvertBGRA8LineToUYVA(const uint8* Src, uint8* DstUYVY, uint8* DstAlpha, int32 Width, float AlphaScale, float AlphaOffset)
+{
+	const VectorRegister BlueColumn  = MakeVectorRegister( 0.06201f,  0.43900f, -0.04001f, 0.0f);
+	const VectorRegister GreenColumn = MakeVectorRegister( 0.61398f, -0.33899f, -0.39900f, 0.0f);
+	const VectorRegister RedColumn   = MakeVectorRegister( 0.18300f, -0.10101f,  0.43902f, 0.0f);
+	const VectorRegister AlphaColumn = MakeVectorRegister( 0.0f, 0.0f, 0.0f, AlphaScale);
+	// Offsets include +0.5 for rounding, as storing to bytes truncates
+	const VectorRegister Offset = MakeVectorRegister(0.06302f * 255.f + 0.5f, 0.50198f * 255.f + 0.5f, 0.50203f * 255.f + 0.5f, AlphaOffset * 255.f + 0.5f);
+	const VectorRegister Half = MakeVectorRegister(0.5f, 0.5f, 0.5f, 0.5f);
+	const VectorRegister MinByte = MakeVectorRegister(0.0f, 0.0f, 0.0f, 0.0f);
+	const VectorRegister MaxByte = MakeVectorRegister(255.0f, 255.0f, 255.0f, 255.0f);
+
+	for (int32 X = 0; X < Width; X += 2, Src += 8, DstUYVY += 4)
+	{
+		// (B, G, R, A) of two pixels
+		VectorRegister Pixel0 = VectorLoadByte4(Src);
+		VectorRegister Pixel1 = VectorLoadByte4(Src + 4);
+
+		// (Y, Cb, Cr, A) of two pixels
+		VectorRegister Out0 = VectorMultiplyAdd(VectorReplicate(Pixel0, 0), BlueColumn, Offset);
+		Out0 = VectorMultiplyAdd(VectorReplicate(Pixel0, 1), GreenColumn, Out0);
+		Out0 = VectorMultiplyAdd(VectorReplicate(Pixel0, 2), RedColumn, Out0);
+		Out0 = VectorMultiplyAdd(VectorReplicate(Pixel0, 3), AlphaColumn, Out0);
+		VectorRegister Out1 = VectorMultiplyAdd(VectorReplicate(Pixel1, 0), BlueColumn, Offset);
+		Out1 = VectorMultiplyAdd(VectorReplicate(Pixel1, 1), GreenColumn, Out1);
+		Out1 = VectorMultiplyAdd(VectorReplicate(Pixel1, 2), RedColumn, Out1);
+		Out1 = VectorMultiplyAdd(VectorReplicate(Pixel1, 3), AlphaColumn, Out1);
+
+		// Chroma is shared by the pixel pair
+		VectorRegister Average = VectorMultiply(VectorAdd(Out0, Out1), Half);
+
+		// Rearrange into (Cb, Y0, Cr, Y1)
+		VectorRegister CbY0 = VectorShuffle(Average, Out0, 1, 1, 0, 0);
+		VectorRegister CrY1 = VectorShuffle(Average, Out1, 2, 2, 0, 0);
+		VectorRegister UYVY = VectorShuffle(CbY0, CrY1, 0, 2, 0, 2);
+
+		VectorStoreByte4(VectorMin(VectorMax(UYVY, MinByte), MaxByte), DstUYVY);
+
+		if (DstAlpha != nullptr)
+		{
+			VectorRegister Alpha = VectorMin(VectorMax(VectorShuffle(Out0, Out1, 3, 3, 3, 3), MinByte), MaxByte);
+			DstAlpha[X] = (uint8)VectorGetComponent(Alpha, 0);
+			DstAlpha[X + 1] = (uint8)VectorGetComponent(Alpha, 2);
+		}
+	}
+}
+
+/**
+	Tables quantizing every half float to a byte, as FLinearColor::ToFColor does for a colour channel with and
+	without the sRGB curve, so that half float pixels are quantized by lookup rather than by a pow per channel
+*/
+struct FHalfToByteTables
+{
+	uint8 Linear[65536];
+	uint8 SRGB[65536];
+
+	FHalfToByteTables()
+	{
+		for (int32 Bits = 0; Bits < 65536; ++Bits)
+		{
+			FFloat16 Half;
+			Half.Encoded = (uint16)Bits;
+
+			FLinearColor Color(Half.GetFloat(), Half.GetFloat(), Half.GetFloat(), Half.GetFloat());
+			Linear[Bits] = Color.ToFColor(false).R;
+			SRGB[Bits] = Color.ToFColor(true).R;
+		}
+	}
+
+	static const FHalfToByteTables& Get()
+	{
+		static const FHalfToByteTables Tables;
+		return Tables;
+	}
+};
+
+/**
+	Quantizes a line of half float RGBA pixels to BGRA8, giving the same bytes as FLinearColor::ToFColor; alpha is
+	never sRGB encoded
+*/
+static void ConvertHalfLineToBGRA8(const FFloat16Color* Src, FColor* Dst, int32 Width, bool bPerformLinearTosRGB)
+{
+	const FHalfToByteTables& Tables = FHalfToByteTables::Get();
+	const uint8* ColorTable = bPerformLinearTosRGB ? Tables.SRGB : Tables.Linear;
 
+	for (int32 X = 0; X < Width; ++X)
+	{
+		Dst[X] = FColor(ColorTable[Src[X].R.Encoded], ColorTable[Src[X].G.Encoded], ColorTable[Src[X].B.Encoded],
+		                Tables.Linear[Src[X].A.Encoded]);
+	}
+}
 
 
 
@@ -364,7 +600,15 @@ void UNDIMediaSender::Initialize()
 			// Update the Render Target Configuration
 			ChangeRenderTargetConfiguration(FrameSize, FrameRate);
 
+			// Start with fresh frame pacing statistics
+			PerformanceData.Reset();
+			PacingCadenceSamples = 0;
+
+			// Send the audio of the submix, until audio is sent from the CPU
+			bIsSendingAudioFromCPU = false;
+
 			// Send audio frames at the end of the 'update' loop
+			ChangeAudioSubmix(AudioSubmix);
 			FNDIConnectionService::EventOnSendAudioFrame.AddUObject(this, &UNDIMediaSender::TrySendAudioFrame);
 
 			// We don't want to limit the engine rendering speed to the sync rate of the connection hook
@@ -476,9 +720,40 @@ bool UNDIMediaSender::CreateSender()
 		NDIlib_send_add_connection_metadata(p_send_instance, &NDI_capabilities);
 	}
 
+	CreateProxySender();
+	CreateRegionSenders();
+
 	return p_send_instance != nullptr ? true : false;
 }
 
+/**
+	Creates the sender of the proxy stream (if enabled), named after the main stream
+*/
+bool UNDIMediaSender::CreateProxySender()
+{
+	if (p_proxy_send_instance != nullptr)
+	{
+		// free up the old proxy sender instance
+		NDIlib_send_destroy(p_proxy_send_instance);
+
+		p_proxy_send_instance = nullptr;
+	}
+
+	if ((p_send_instance != nullptr) && (this->bEnableProxyStream == true))
+	{
+		NDIlib_send_create_t settings;
+		settings.clock_audio = false;
+		settings.clock_video = false;
+		// Beware of the limited lifetime of TCHAR_TO_UTF8 values
+		std::string ProxyNameStr(TCHAR_TO_UTF8(*GetProxySourceName()));
+		settings.p_ndi_name = ProxyNameStr.c_str();
+
+		p_proxy_send_instance = NDIlib_send_create(&settings);
+	}
+
+	return p_proxy_send_instance != nullptr ? true : false;
+}
+
 
 /**
 	Changes the name of the sender object as seen on the network for remote connections
@@ -497,6 +772,11 @@ void UNDIMediaSender::ChangeSourceName(const FString& InSourceName)
 
 		// send an empty frame over NDI to be able to cleanup the buffers
 		ReadbackTextures.Flush(RHICmdList, p_send_instance);
+		if (p_proxy_send_instance != nullptr)
+			ProxyReadbackTextures.Flush(RHICmdList, p_proxy_send_instance);
+
+		// The last frame sent is no longer mapped, so the next frame must be sent in full
+		LastFingerprint.Reset();
 
 		CreateSender();
 	}
@@ -532,30 +812,26 @@ void UNDIMediaSender::ChangeBroadcastConfiguration(const FNDIBroadcastConfigurat
 	This will attempt to generate an audio frame, add the frame to the stack and return immediately,
 	having scheduled the frame asynchronously.
 */
-void UNDIMediaSender::TrySendAudioFrame(int64 time_code, float* AudioData, int32 NumSamples, int32 NumChannels, const int32 SampleRate, double AudioClock)
+void UNDIMediaSender::TrySendAudioFrame(const FNDISubmixAudioFramePtr& AudioFrame)
 {
-	if (bEnableAudio && (p_send_instance != nullptr) && (!bIsChangingBroadcastSize))
+	if (bEnableAudio && (p_send_instance != nullptr) && (!bIsChangingBroadcastSize) && (!bIsSendingAudioFromCPU) && AudioFrame.IsValid())
 	{
 		FScopeLock Lock(&AudioSyncContext);
 
-		if (NDIlib_send_get_no_connections(p_send_instance, 0) > 0)
-		{
-			// Convert from the interleaved audio that Unreal Engine produces
-
-			NDIlib_audio_frame_interleaved_32f_t NDI_interleaved_audio_frame;
-			NDI_interleaved_audio_frame.timecode = time_code;
-			NDI_interleaved_audio_frame.sample_rate = SampleRate;
-			NDI_interleaved_audio_frame.no_channels = NumChannels;
-			NDI_interleaved_audio_frame.no_samples = NumSamples / NumChannels;
-			NDI_interleaved_audio_frame.p_data = AudioData;
+		// Only send the audio of the submix this sender is routed to
+		bool bIsRoutedSubmix = (ListenedAudioSubmix != nullptr) ? (AudioFrame->Submix == ListenedAudioSubmix)
+																: AudioFrame->bIsMainSubmix;
 
+		if (bIsRoutedSubmix && (NDIlib_send_get_no_connections(p_send_instance, 0) > 0))
+		{
+			// The audio has already been deinterleaved once by the connection service for all senders
 			NDIlib_audio_frame_v2_t NDI_audio_frame;
-			SendAudioData.Reset(NumSamples);
-			NDI_audio_frame.p_data = SendAudioData.GetData();
-			NDI_audio_frame.channel_stride_in_bytes = (NumSamples / NumChannels) * sizeof(float);
-
-			NDIlib_util_audio_from_interleaved_32f_v2(&NDI_interleaved_audio_frame, &NDI_audio_frame);
-
+			NDI_audio_frame.timecode = AudioFrame->Timecode;
+			NDI_audio_frame.sample_rate = AudioFrame->SampleRate;
+			NDI_audio_frame.no_channels = AudioFrame->NumChannels;
+			NDI_audio_frame.no_samples = AudioFrame->NumSamples;
+			NDI_audio_frame.p_data = AudioFrame->PlanarData.GetData();
+			NDI_audio_frame.channel_stride_in_bytes = AudioFrame->ChannelStrideInBytes;
 
 			OnSenderAudioPreSend.Broadcast(this);
 
@@ -579,30 +855,54 @@ void UNDIMediaSender::TrySendVideoFrame(int64 time_code)
 	{
 		FScopeLock Lock(&RenderSyncContext);
 
+		RenderSendThreadId = FPlatformTLS::GetCurrentThreadId();
+		ON_SCOPE_EXIT
+		{
+			RenderSendThreadId = 0;
+		};
+
 		while(GetMetadataFrame())
 			; // Potential improvement: limit how much metadata is processed, to avoid appearing to lock up due to a metadata flood
 
-		if (GetRenderTargetResource() != nullptr)
+		if (GetInputTextureRHI().IsValid())
 		{
 			// Alright time to perform the magic :D
 			if (NDIlib_send_get_no_connections(p_send_instance, 0) > 0)
 			{
+				// The timecode is in 100ns units already, converting it through seconds in single precision would
+				// lose whole frames late in the day
 				FTimecode RenderTimecode =
-					FTimecode::FromTimespan(FTimespan::FromSeconds(time_code / (float)1e+7), FrameRate,
+					FTimecode::FromTimespan(FTimespan(time_code), FrameRate,
 											FTimecode::IsDropFormatTimecodeSupported(FrameRate),
 											true // use roll-over timecode
 					);
 
-				if (RenderTimecode.Frames != LastRenderTime.Frames)
+				// Stop the output clock once pacing is turned off, so that the pacing worker sleeps until it is
+				// turned on again
+				if ((bEnableFramePacing == false) && (bIsPacingClockRunning == true))
+					ResetFramePacing();
+
+				// Determine which output frame this engine frame is for, and whether it is needed at all
+				uint64 NowCycles = FPlatformTime::Cycles64();
+				int64 OutputSlot = 0;
+				bool bShouldSend = (bEnableFramePacing == true) ? SchedulePacedFrame(time_code, NowCycles, OutputSlot)
+				                                                : (RenderTimecode.Frames != LastRenderTime.Frames);
+
+				if (bShouldSend)
 				{
 					// Get the command list interface
 					FRHICommandListImmediate& RHICmdList = FRHICommandListExecutor::GetImmediateCommandList();
 
 					// alright, lets hope the render target hasn't changed sizes
-					NDI_video_frame.timecode = time_code;
+					NDI_video_frame.timecode = (bEnableFramePacing == true) ? GetPacedTimecode(OutputSlot) : time_code;
 
+					// Frames identical to the last frame sent are neither converted nor read back
+					if ((bSkipUnchangedFrames == true) && IsInputUnchanged(RHICmdList))
+					{
+						SendUnchangedFrame(NowCycles, OutputSlot);
+					}
 					// performing color conversion if necessary and copy pixels into the data buffer for sending
-					if (DrawRenderTarget(RHICmdList))
+					else if (DrawRenderTarget(RHICmdList))
 					{
 						int32 Width = 0, Height = 0;
 
@@ -611,8 +911,11 @@ void UNDIMediaSender::TrySendVideoFrame(int64 time_code)
 						// Width and height are the size of the readback texture, and not the framesize represented
 						// Readback texture is used in 4:2:2 format, so actual width in pixels is double
 						Width *= 2;
+						// Readback texture holds the 16 bits planes one below the other; keep only the luma plane
+						if (ReadbackTexturesAre16Bit == true)
+							Height = Height / (ReadbackTexturesHaveAlpha ? 3 : 2);
 						// Readback texture may be extended in height to accomodate alpha values; remove it
-						if (ReadbackTexturesHaveAlpha == true)
+						else if (ReadbackTexturesHaveAlpha == true)
 							Height = (2*Height) / 3;
 
 						// If we don't have a draw result, ensure we send an empty frame and resize our frame
@@ -622,10 +925,15 @@ void UNDIMediaSender::TrySendVideoFrame(int64 time_code)
 							ReadbackTextures.Flush(RHICmdList, p_send_instance);
 
 							// Do not hold the lock when going into ChangeRenderTargetConfiguration()
+							RenderSendThreadId = 0;
 							Lock.Unlock();
 
 							// Change the render target configuration based on what the RHI determines the size to be
 							ChangeRenderTargetConfiguration(FIntPoint(Width, Height), this->FrameRate);
+
+							// The proxy and region streams are being rebuilt without the lock, so they wait for the
+							// next frame
+							return;
 						}
 						else
 						{
@@ -634,154 +942,1112 @@ void UNDIMediaSender::TrySendVideoFrame(int64 time_code)
 							// send the frame over NDI
 							ReadbackTextures.Send(RHICmdList, p_send_instance, NDI_video_frame);
 
+							// The fingerprint of this frame is the reference for the frames which follow
+							if (bSkipUnchangedFrames == true)
+								CommitFingerprint();
+
 							// Update the Last Render Time to the current Render Timecode
 							LastRenderTime = RenderTimecode;
+							LastVideoSendCycles = NowCycles;
+
+							if (bEnableFramePacing == true)
+								CompletePacedFrame(OutputSlot, NowCycles);
+							else
+								PerformanceData.VideoFrames++;
 
 							OnSenderVideoSent.Broadcast(this);
 						}
 					}
 				}
 			}
+			else
+			{
+				// Restart the output clock when receivers connect again
+				ResetFramePacing();
+			}
+
+			// The proxy stream is only converted and sent while it has receivers of its own
+			if ((p_proxy_send_instance != nullptr) && !bIsChangingBroadcastSize)
+			{
+				TrySendProxyVideoFrame(time_code);
+			}
+
+		}
+
+		// Likewise for the streams of the output regions and of the other textures, which do not need the input
+		if ((RegionOutputs.Num() > 0) && !bIsChangingBroadcastSize)
+		{
+			TrySendRegionVideoFrames(time_code);
 		}
 	}
 }
 
 /**
-	Perform the color conversion (if any) and bit copy from the gpu
+	Converts and sends a frame of the proxy stream, if it has receivers and a new proxy frame is due
 */
-bool UNDIMediaSender::DrawRenderTarget(FRHICommandListImmediate& RHICmdList)
+void UNDIMediaSender::TrySendProxyVideoFrame(int64 time_code)
 {
-	bool DrawResult = false;
+	check(RenderSendThreadId == FPlatformTLS::GetCurrentThreadId());
 
-	// We should only do conversions and pixel copies, if we have something to work with
-	if (!bIsChangingBroadcastSize && (GetRenderTargetResource() != nullptr))
-	{
-		// Get the underlying texture to use for the color conversion
-		FTexture2DRHIRef SourceTexture = (FTexture2DRHIRef&)GetRenderTargetResource()->TextureRHI;
+	if (NDIlib_send_get_no_connections(p_proxy_send_instance, 0) <= 0)
+		return;
 
-		// Validate the Source Texture
-		if (SourceTexture.IsValid())
-		{
-			// We have something to draw
-			DrawResult = true;
+	// The proxy stream sends at most one frame per proxy frame duration
+	int64 ProxySlot = (time_code * ProxyFrameRate.Numerator) / ((int64)ProxyFrameRate.Denominator * ETimespan::TicksPerSecond);
+	if (ProxySlot == LastProxySlot)
+		return;
 
-			TRefCountPtr<IPooledRenderTarget> RenderTargetTexturePooled;
+	// Get the command list interface
+	FRHICommandListImmediate& RHICmdList = FRHICommandListExecutor::GetImmediateCommandList();
 
-			// Find a free target-able texture from the render pool
-			GRenderTargetPool.FindFreeElement(RHICmdList, RenderTargetDescriptor, RenderTargetTexturePooled, TEXT("NDIIO"));
+	if (DrawProxyRenderTarget(RHICmdList))
+	{
+		int32 Width = 0, Height = 0;
 
-#if ENGINE_MAJOR_VERSION >= 5
-			FRHITexture* TargetableTexture = RenderTargetTexturePooled->GetRHI();
-#elif ENGINE_MAJOR_VERSION == 4
-			FRHITexture* TargetableTexture = RenderTargetTexturePooled->GetRenderTargetItem().TargetableTexture.GetReference();
-#else
-			#error "Unsupported engine major version"
-#endif
+		// Map the staging surface so we can copy the buffer for the NDI SDK to use
+		ProxyReadbackTextures.Map(RHICmdList, Width, Height);
 
-			// Get the target size of the conversion
-			FIntPoint TargetSize = SourceTexture->GetSizeXY();
+		// The mapped width may be padded, so follow it for the line stride
+		NDI_proxy_video_frame.line_stride_in_bytes = FMath::Max(Width * 4, EffectiveProxyFrameSize.X * 2);
+		NDI_proxy_video_frame.timecode = time_code;
 
-			// Calculate the rectangle in which to draw the source, maintaining aspect ratio
-			float FrameRatio = FrameSize.X / (float)FrameSize.Y;
-			float TargetRatio = TargetSize.X / (float)TargetSize.Y;
+		ProxyReadbackTextures.Send(RHICmdList, p_proxy_send_instance, NDI_proxy_video_frame);
 
-			FIntPoint NewFrameSize = FrameSize;
+		LastProxySlot = ProxySlot;
+	}
+}
 
-			if (TargetRatio > FrameRatio)
-			{
-				// letterbox
-				NewFrameSize.Y = FMath::RoundToInt(FrameSize.X / TargetRatio);
-			}
-			else if (TargetRatio < FrameRatio)
-			{
-				// pillarbox
-				NewFrameSize.X = FMath::RoundToInt(FrameSize.Y * TargetRatio);
-			}
+/**
+	Perform the downscale and color conversion to UYVY of the proxy stream, and bit copy from the gpu
+*/
+bool UNDIMediaSender::DrawProxyRenderTarget(FRHICommandListImmediate& RHICmdList)
+{
+	FTexture2DRHIRef SourceTexture = GetInputTextureRHI();
+	if (!SourceTexture.IsValid())
+		return false;
 
-			float ULeft   = (NewFrameSize.X - FrameSize.X) / (float)(2*NewFrameSize.X);
-			float URight  = (NewFrameSize.X + FrameSize.X) / (float)(2*NewFrameSize.X);
-			float VTop    = (NewFrameSize.Y - FrameSize.Y) / (float)(2*NewFrameSize.Y);
-			float VBottom = (NewFrameSize.Y + FrameSize.Y) / (float)(2*NewFrameSize.Y);
+	TRefCountPtr<IPooledRenderTarget> RenderTargetTexturePooled;
+
+	// Find a free target-able texture from the render pool
+	GRenderTargetPool.FindFreeElement(RHICmdList, ProxyRenderTargetDescriptor, RenderTargetTexturePooled, TEXT("NDIIO Proxy"));
 
 #if ENGINE_MAJOR_VERSION >= 5
-			FBufferRHIRef ColorVertexBuffer = CreateColorVertexBuffer(RHICmdList, FrameSize, NewFrameSize, this->OutputAlpha);
-			FBufferRHIRef AlphaEvenVertexBuffer = CreateAlphaEvenVertexBuffer(RHICmdList, FrameSize, NewFrameSize, this->OutputAlpha);
-			FBufferRHIRef AlphaOddVertexBuffer = CreateAlphaOddVertexBuffer(RHICmdList, FrameSize, NewFrameSize, this->OutputAlpha);
+	FRHITexture* TargetableTexture = RenderTargetTexturePooled->GetRHI();
 #elif ENGINE_MAJOR_VERSION == 4
-			FVertexBufferRHIRef ColorVertexBuffer = CreateColorVertexBuffer(FrameSize, NewFrameSize, this->OutputAlpha);
-			FVertexBufferRHIRef AlphaEvenVertexBuffer = CreateAlphaEvenVertexBuffer(FrameSize, NewFrameSize, this->OutputAlpha);
-			FVertexBufferRHIRef AlphaOddVertexBuffer = CreateAlphaOddVertexBuffer(FrameSize, NewFrameSize, this->OutputAlpha);
+	FRHITexture* TargetableTexture = RenderTargetTexturePooled->GetRenderTargetItem().TargetableTexture.GetReference();
 #else
-			#error "Unsupported engine major version"
+	#error "Unsupported engine major version"
 #endif
 
-			// Initialize the Graphics Pipeline State Object
-			FGraphicsPipelineStateInitializer GraphicsPSOInit;
-
-			// Configure shaders
-			FGlobalShaderMap* ShaderMap = GetGlobalShaderMap(GMaxRHIFeatureLevel);
-
-			// Construct the shaders
-			TShaderMapRef<FNDIIOShaderVS> VertexShader(ShaderMap);
-			TShaderMapRef<FNDIIOShaderBGRAtoUYVYPS> ConvertShader(ShaderMap);
-			TShaderMapRef<FNDIIOShaderBGRAtoAlphaEvenPS> ConvertAlphaEvenShader(ShaderMap);
-			TShaderMapRef<FNDIIOShaderBGRAtoAlphaOddPS> ConvertAlphaOddShader(ShaderMap);
+	// Calculate the rectangle in which to draw the source, maintaining aspect ratio
+	FIntPoint TargetSize = SourceTexture->GetSizeXY();
+	float FrameRatio = EffectiveProxyFrameSize.X / (float)EffectiveProxyFrameSize.Y;
+	float TargetRatio = TargetSize.X / (float)TargetSize.Y;
 
-			// Scaled drawing pass with conversion to UYVY
-			{
-				// Initialize the Render pass with the conversion texture
-				FRHITexture* ConversionTexture = TargetableTexture;
-				FRHIRenderPassInfo RPInfo(ConversionTexture, ERenderTargetActions::DontLoad_Store);
-
-				RHICmdList.BeginRenderPass(RPInfo, TEXT("NDI Send Scaling Conversion"));
+	FIntPoint NewFrameSize = EffectiveProxyFrameSize;
+	if (TargetRatio > FrameRatio)
+		NewFrameSize.Y = FMath::RoundToInt(EffectiveProxyFrameSize.X / TargetRatio);
+	else if (TargetRatio < FrameRatio)
+		NewFrameSize.X = FMath::RoundToInt(EffectiveProxyFrameSize.Y * TargetRatio);
 
-				// Do as it suggests
-				RHICmdList.ApplyCachedRenderTargets(GraphicsPSOInit);
-				// Set the state objects
-				GraphicsPSOInit.DepthStencilState = TStaticDepthStencilState<false, CF_Always>::GetRHI();
-				GraphicsPSOInit.RasterizerState = TStaticRasterizerState<>::GetRHI();
-				GraphicsPSOInit.BlendState = TStaticBlendStateWriteMask<CW_RGBA, CW_NONE, CW_NONE, CW_NONE, CW_NONE,
-																		CW_NONE, CW_NONE, CW_NONE>::GetRHI();
-				// Perform binding operations for the shaders to be used
-				GraphicsPSOInit.BoundShaderState.VertexDeclarationRHI = GMediaVertexDeclaration.VertexDeclarationRHI;
-				GraphicsPSOInit.BoundShaderState.VertexShaderRHI = VertexShader.GetVertexShader();
-				GraphicsPSOInit.BoundShaderState.PixelShaderRHI = ConvertShader.GetPixelShader();
-				// Going to draw triangle strips
-				GraphicsPSOInit.PrimitiveType = PT_TriangleStrip;
+	float ULeft   = (NewFrameSize.X - EffectiveProxyFrameSize.X) / (float)(2*NewFrameSize.X);
+	float URight  = (NewFrameSize.X + EffectiveProxyFrameSize.X) / (float)(2*NewFrameSize.X);
+	float VTop    = (NewFrameSize.Y - EffectiveProxyFrameSize.Y) / (float)(2*NewFrameSize.Y);
+	float VBottom = (NewFrameSize.Y + EffectiveProxyFrameSize.Y) / (float)(2*NewFrameSize.Y);
 
-				// Ensure the pipeline state is set to the one we've configured
 #if ENGINE_MAJOR_VERSION >= 5
-				SetGraphicsPipelineState(RHICmdList, GraphicsPSOInit, 0);
+	FBufferRHIRef VertexBuffer = CreatePlaneVertexBuffer(RHICmdList, 0, 1);
 #elif ENGINE_MAJOR_VERSION == 4
-				SetGraphicsPipelineState(RHICmdList, GraphicsPSOInit);
+	FVertexBufferRHIRef VertexBuffer = CreatePlaneVertexBuffer(0, 1);
 #else
-				#error "Unsupported engine major version"
+	#error "Unsupported engine major version"
 #endif
 
-				// Set the stream source
-				RHICmdList.SetStreamSource(0, ColorVertexBuffer, 0);
+	// Scaled drawing pass with conversion to UYVY, using the same conversion shader as the main stream
+	FNDIIOShaderPS::Params Params(SourceTexture, DefaultVideoTextureRHI, EffectiveProxyFrameSize,
+	                              FVector2D(ULeft, VTop), FVector2D(URight-ULeft, VBottom-VTop),
+	                              bPerformLinearTosRGB ? FNDIIOShaderPS::EColorCorrection::LinearTosRGB : FNDIIOShaderPS::EColorCorrection::None,
+	                              FVector2D(this->AlphaMin, this->AlphaMax));
 
-				// Set the texture parameter of the conversion shader
-				FNDIIOShaderBGRAtoUYVYPS::Params Params(SourceTexture, DefaultVideoTextureRHI, FrameSize,
-				                                        FVector2D(ULeft, VTop), FVector2D(URight-ULeft, VBottom-VTop),
-				                                        bPerformLinearTosRGB ? FNDIIOShaderPS::EColorCorrection::LinearTosRGB : FNDIIOShaderPS::EColorCorrection::None,
-				                                        FVector2D(this->AlphaMin, this->AlphaMax));
-				ConvertShader->SetParameters(RHICmdList, Params);
+	DrawConversionPass<FNDIIOShaderBGRAtoUYVYPS>(RHICmdList, TargetableTexture, ERenderTargetActions::DontLoad_Store,
+	                                             VertexBuffer, Params, DefaultVideoTextureRHI);
 
-				// Draw the texture
-				RHICmdList.DrawPrimitive(0, 2, 1);
+	Params.InputTarget = DefaultVideoTextureRHI;
 
-				// Release the reference to SourceTexture from the shader
-				// The SourceTexture may be the viewport's backbuffer, and Unreal does not like
-				// extra references to the backbuffer when the viewport is resized
-				Params.InputTarget = DefaultVideoTextureRHI;
-				ConvertShader->SetParameters(RHICmdList, Params);
+	ProxyReadbackTextures.Resolve(RHICmdList, TargetableTexture);
+
+	// Force all the drawing to be done here and now
+	RHICmdList.ImmediateFlush(EImmediateFlushType::FlushRHIThreadFlushResources);
+
+	return true;
+}
+
+/**
+	Computes the fingerprint of the input texture on the GPU, and returns whether the fingerprint of the previous
+	frame matches the last frame sent. Each value of the fingerprint hashes every texel of a block of the input
+	texture, so that only the fingerprint is read back to detect any change. It is read back with the next frame,
+	by which time the GPU has produced it, rather than flushing and waiting for it.
+*/
+bool UNDIMediaSender::IsInputUnchanged(FRHICommandListImmediate& RHICmdList)
+{
+	const int32 Size = FingerprintSize;
+
+	FTexture2DRHIRef SourceTexture = GetInputTextureRHI();
+	if (!SourceTexture.IsValid() || !FingerprintRenderTargetDescriptor.IsValid())
+		return false;
+
+	bool bIsUnchanged = false;
+
+	// Compare the fingerprint of the previous frame with the last frame sent
+	FFingerprintReadback& PreviousReadback = FingerprintReadbacks[1 - FingerprintIndex];
+	if (PreviousReadback.bIsPending == true)
+	{
+		int32 Width = 0, Height = 0;
+		PreviousReadback.Texture.Map(RHICmdList, Width, Height);
+
+		// The mapped width may be padded, so follow it for the line stride
+		const uint32* Fingerprint = (const uint32*)PreviousReadback.Texture.MappedData();
+		int32 LineStride = FMath::Max(Width, Size);
+
+		bIsUnchanged = (LastFingerprint.Num() == Size * Size);
+		for (int32 Y = 0; bIsUnchanged && (Y < Size); ++Y)
+		{
+			if (FMemory::Memcmp(Fingerprint + Y * LineStride, LastFingerprint.GetData() + Y * Size, Size * sizeof(uint32)) != 0)
+				bIsUnchanged = false;
+		}
+
+		// The fingerprint only becomes the reference once its frame has actually been sent
+		if (PreviousReadback.bWasSent == true)
+		{
+			LastFingerprint.SetNumUninitialized(Size * Size, false);
+			for (int32 Y = 0; Y < Size; ++Y)
+				FMemory::Memcpy(LastFingerprint.GetData() + Y * Size, Fingerprint + Y * LineStride, Size * sizeof(uint32));
+		}
+
+		PreviousReadback.Texture.Unmap(RHICmdList);
+		PreviousReadback.bIsPending = false;
+	}
+
+	TRefCountPtr<IPooledRenderTarget> RenderTargetTexturePooled;
+
+	// Find a free target-able texture from the render pool
+	GRenderTargetPool.FindFreeElement(RHICmdList, FingerprintRenderTargetDescriptor, RenderTargetTexturePooled, TEXT("NDIIO Fingerprint"));
+
+#if ENGINE_MAJOR_VERSION >= 5
+	FRHITexture* TargetableTexture = RenderTargetTexturePooled->GetRHI();
+	FBufferRHIRef VertexBuffer = CreatePlaneVertexBuffer(RHICmdList, 0, 1);
+#elif ENGINE_MAJOR_VERSION == 4
+	FRHITexture* TargetableTexture = RenderTargetTexturePooled->GetRenderTargetItem().TargetableTexture.GetReference();
+	FVertexBufferRHIRef VertexBuffer = CreatePlaneVertexBuffer(0, 1);
+#else
+	#error "Unsupported engine major version"
+#endif
+
+	FNDIIOShaderPS::Params Params(SourceTexture, DefaultVideoTextureRHI, FIntPoint(Size, Size),
+	                              FVector2D(0.0f, 0.0f), FVector2D(1.0f, 1.0f),
+	                              FNDIIOShaderPS::EColorCorrection::None, FVector2D(0.0f, 1.0f));
+
+	DrawConversionPass<FNDIIOShaderFingerprintPS>(RHICmdList, TargetableTexture, ERenderTargetActions::DontLoad_Store,
+	                                              VertexBuffer, Params, DefaultVideoTextureRHI);
+
+	// Fingerprint this frame, to be read back with the next one
+	FFingerprintReadback& CurrentReadback = FingerprintReadbacks[FingerprintIndex];
+	CurrentReadback.Texture.Resolve(RHICmdList, TargetableTexture);
+	CurrentReadback.bIsPending = true;
+	CurrentReadback.bWasSent = false;
+
+	FingerprintIndex = 1 - FingerprintIndex;
+
+	// Metadata waiting to be attached to a video frame is sent with a new frame
+	return bIsUnchanged && (ReadbackTextures.HasMetaData() == false);
+}
+
+/**
+	Records that the frame fingerprinted last has been sent, so that its fingerprint becomes the reference
+*/
+void UNDIMediaSender::CommitFingerprint()
+{
+	FFingerprintReadback& CurrentReadback = FingerprintReadbacks[1 - FingerprintIndex];
+	if (CurrentReadback.bIsPending == true)
+		CurrentReadback.bWasSent = true;
+}
+
+/**
+	Sends the last frame again if the keep-alive rate requires it, instead of an unchanged frame; otherwise the
+	unchanged frame is dropped
+*/
+void UNDIMediaSender::SendUnchangedFrame(uint64 NowCycles, int64 OutputSlot)
+{
+	PerformanceData.UnchangedVideoFrames++;
+
+	if (UnchangedFrameKeepAliveRate.Numerator > 0)
+	{
+		// Allow half a frame of jitter, so that a keep-alive rate equal to the frame rate sends every frame
+		double SinceLastSend = (NowCycles - LastVideoSendCycles) * FPlatformTime::GetSecondsPerCycle64();
+		double Tolerance = (FrameRate.Numerator > 0) ? FrameRate.AsInterval() / 2.0 : 0.0;
+
+		if (SinceLastSend + Tolerance >= UnchangedFrameKeepAliveRate.AsInterval())
+		{
+			NDIlib_video_frame_v2_t RepeatedFrame = NDI_video_frame;
+			RepeatedFrame.p_metadata = nullptr;
+
+			if (ReadbackTextures.Resend(p_send_instance, RepeatedFrame) == true)
+			{
+				PerformanceData.RepeatedVideoFrames++;
+				LastVideoSendCycles = NowCycles;
+			}
+			else
+			{
+				// The last frame sent is no longer mapped, so the next frame must be sent in full
+				LastFingerprint.Reset();
+			}
+		}
+	}
+
+	// The output frame is accounted for, whether the last frame was sent again or not
+	if (bEnableFramePacing == true)
+	{
+		ClaimPacedSlot(OutputSlot);
+		PacingLastSendSlot = OutputSlot;
+		PacingLastSendCycles = NowCycles;
+		PacingRepeatCount = 0;
+	}
+}
+
+/**
+	Returns the name under which the proxy stream is seen on the network
+*/
+FString UNDIMediaSender::GetProxySourceName() const
+{
+	return this->SourceName + TEXT(" (Proxy)");
+}
+
+/**
+	Changes the rectangles of the Render Target published as streams of their own
+*/
+void UNDIMediaSender::ChangeOutputRegions(const TArray<FNDISenderRegion>& InOutputRegions)
+{
+	FScopeLock RenderLock(&RenderSyncContext);
+
+	this->OutputRegions = InOutputRegions;
+
+	if (p_send_instance != nullptr)
+		CreateRegionSenders();
+}
+
+/**
+	Creates the senders of the output regions and of the texture streams, which replace the current ones on the
+	render thread
+*/
+void UNDIMediaSender::CreateRegionSenders()
+{
+	TArray<FRegionOutput> NewRegionOutputs;
+
+	if (p_send_instance != nullptr)
+	{
+		for (int32 RegionIndex = 0; RegionIndex < OutputRegions.Num(); ++RegionIndex)
+		{
+			FRegionOutput& Output = NewRegionOutputs.AddDefaulted_GetRef();
+			Output.Region = OutputRegions[RegionIndex];
+			Output.p_send_instance = CreateRegionSendInstance(GetRegionSourceName(RegionIndex));
+		}
+
+		for (const TPair<const void*, FNDISenderRegion>& TextureStream : TextureStreams)
+		{
+			FRegionOutput& Output = NewRegionOutputs.AddDefaulted_GetRef();
+			Output.StreamKey = TextureStream.Key;
+			Output.Region = TextureStream.Value;
+			Output.p_send_instance = CreateRegionSendInstance(TextureStream.Value.Name);
+		}
+	}
+
+	ReplaceRegionOutputs(MoveTemp(NewRegionOutputs));
+}
+
+/**
+	Creates the sender of a single region or texture stream
+*/
+NDIlib_send_instance_t UNDIMediaSender::CreateRegionSendInstance(const FString& StreamName)
+{
+	NDIlib_send_create_t settings;
+	settings.clock_audio = false;
+	settings.clock_video = false;
+	// Beware of the limited lifetime of TCHAR_TO_UTF8 values
+	std::string StreamNameStr(TCHAR_TO_UTF8(*StreamName));
+	settings.p_ndi_name = StreamNameStr.c_str();
+
+	return NDIlib_send_create(&settings);
+}
+
+/**
+	Adds a stream converted from a texture other than the input, or changes its frame size
+*/
+void UNDIMediaSender::ChangeTextureStream(const void* StreamKey, const FString& StreamName, FIntPoint StreamFrameSize)
+{
+	FScopeLock RenderLock(&RenderSyncContext);
+
+	FNDISenderRegion* ExistingStream = TextureStreams.Find(StreamKey);
+	if ((ExistingStream != nullptr) && (ExistingStream->Name == StreamName))
+	{
+		// Only the layout of the shared conversion texture changes, the stream keeps its receivers
+		ExistingStream->Size = StreamFrameSize;
+
+		ENQUEUE_RENDER_COMMAND(NDIMediaSender_ResizeTextureStreamRT)([this, StreamKey, StreamFrameSize](FRHICommandListImmediate& RHICmdList)
+		{
+			FScopeLock RenderLock(&RenderSyncContext);
+
+			FlushRegionStreams(RHICmdList);
+
+			for (FRegionOutput& Output : RegionOutputs)
+			{
+				if (Output.StreamKey == StreamKey)
+					Output.Region.Size = StreamFrameSize;
+			}
+
+			ConfigureRegions(RHICmdList);
+		});
+		return;
+	}
+
+	if (ExistingStream != nullptr)
+		RemoveTextureStream(StreamKey);
+
+	FNDISenderRegion& NewStream = TextureStreams.Add(StreamKey);
+	NewStream.Name = StreamName;
+	NewStream.Size = StreamFrameSize;
+
+	if (p_send_instance == nullptr)
+		return;
+
+	FRegionOutput NewOutput;
+	NewOutput.StreamKey = StreamKey;
+	NewOutput.Region = NewStream;
+	NewOutput.p_send_instance = CreateRegionSendInstance(StreamName);
+
+	ENQUEUE_RENDER_COMMAND(NDIMediaSender_AddTextureStreamRT)([this, NewOutput](FRHICommandListImmediate& RHICmdList)
+	{
+		FScopeLock RenderLock(&RenderSyncContext);
+
+		FlushRegionStreams(RHICmdList);
+		RegionOutputs.Add(NewOutput);
+		ConfigureRegions(RHICmdList);
+	});
+}
+
+/**
+	Removes a stream converted from a texture other than the input
+*/
+void UNDIMediaSender::RemoveTextureStream(const void* StreamKey)
+{
+	FScopeLock RenderLock(&RenderSyncContext);
+
+	if (TextureStreams.Remove(StreamKey) == 0)
+		return;
+
+	ENQUEUE_RENDER_COMMAND(NDIMediaSender_RemoveTextureStreamRT)([this, StreamKey](FRHICommandListImmediate& RHICmdList)
+	{
+		FScopeLock RenderLock(&RenderSyncContext);
+
+		FlushRegionStreams(RHICmdList);
+
+		for (int32 OutputIndex = RegionOutputs.Num() - 1; OutputIndex >= 0; --OutputIndex)
+		{
+			if (RegionOutputs[OutputIndex].StreamKey == StreamKey)
+			{
+				if (RegionOutputs[OutputIndex].p_send_instance != nullptr)
+					NDIlib_send_destroy(RegionOutputs[OutputIndex].p_send_instance);
+				RegionOutputs.RemoveAt(OutputIndex);
+			}
+		}
+
+		ConfigureRegions(RHICmdList);
+	});
+}
+
+/**
+	Changes the texture a texture stream is converted from. The sender holds a reference to the texture until
+	this is called again with nullptr.
+*/
+void UNDIMediaSender::ChangeTextureStreamInputRHI(const void* StreamKey, const FTexture2DRHIRef& Texture)
+{
+	FScopeLock RenderLock(&RenderSyncContext);
+
+	for (FRegionOutput& Output : RegionOutputs)
+	{
+		if (Output.StreamKey == StreamKey)
+			Output.InputTexture = Texture;
+	}
+}
+
+/**
+	Releases the textures of every texture stream, for instance before back buffers are resized
+*/
+void UNDIMediaSender::ReleaseTextureStreamInputs()
+{
+	FScopeLock RenderLock(&RenderSyncContext);
+
+	for (FRegionOutput& Output : RegionOutputs)
+		Output.InputTexture.SafeRelease();
+}
+
+/**
+	Flushes and destroys the senders of the output regions
+*/
+void UNDIMediaSender::DestroyRegionSenders()
+{
+	ReplaceRegionOutputs(TArray<FRegionOutput>());
+}
+
+/**
+	The region streams share readback textures which may be mapped, and those can only be unmapped on the render
+	thread, so the streams are flushed, destroyed and replaced there, between two frames sent
+*/
+void UNDIMediaSender::ReplaceRegionOutputs(TArray<FRegionOutput>&& NewRegionOutputs)
+{
+	ENQUEUE_RENDER_COMMAND(NDIMediaSender_ReplaceRegionsRT)([this, NewRegionOutputs = MoveTemp(NewRegionOutputs)](FRHICommandListImmediate& RHICmdList) mutable
+	{
+		FScopeLock RenderLock(&RenderSyncContext);
+
+		FlushRegionStreams(RHICmdList);
+
+		for (FRegionOutput& Output : RegionOutputs)
+		{
+			if (Output.p_send_instance != nullptr)
+				NDIlib_send_destroy(Output.p_send_instance);
+		}
+
+		RegionOutputs = MoveTemp(NewRegionOutputs);
+
+		ConfigureRegions(RHICmdList);
+	});
+}
+
+/**
+	Flushes the streams of the output regions, after which the shared readback textures are unmapped
+*/
+void UNDIMediaSender::FlushRegionStreams(FRHICommandListImmediate& RHICmdList)
+{
+	for (FRegionOutput& Output : RegionOutputs)
+	{
+		if ((Output.p_send_instance != nullptr) && (Output.bHasPendingFrame == true))
+			NDIlib_send_send_video_async_v2(Output.p_send_instance, nullptr);
+		Output.bHasPendingFrame = false;
+	}
+
+	this->RegionReadbackTextures.Unmap(RHICmdList);
+}
+
+/**
+	Lays the output regions out one below the other in the shared conversion texture, so that each region is
+	a contiguous range of lines of the readback, and describes the video frames of their streams. The regions are
+	clamped to the input texture, which may differ from the frame size, and regions entirely outside of it are not
+	sent. Texture streams are laid out likewise.
+*/
+void UNDIMediaSender::ConfigureRegions(FRHICommandListImmediate& RHICmdList)
+{
+	FlushRegionStreams(RHICmdList);
+
+	// Without an input the output regions are laid out again once there is one
+	FTexture2DRHIRef SourceTexture = GetInputTextureRHI();
+	RegionSourceSize = SourceTexture.IsValid() ? SourceTexture->GetSizeXY() : FIntPoint::ZeroValue;
+
+	int32 TextureWidth = 0;
+	int32 TextureHeight = 0;
+
+	for (FRegionOutput& Output : RegionOutputs)
+	{
+		const FNDISenderRegion& Region = Output.Region;
+
+		// Output regions are cut from the frame, texture streams are scaled from the whole of their texture
+		FIntRect SourceRect(Region.Offset, Region.Offset + Region.Size);
+		if (Output.StreamKey == nullptr)
+			SourceRect.Clip(FIntRect(FIntPoint(0, 0), RegionSourceSize));
+
+		// UYVY holds pairs of pixels, so the width of a region is even
+		FIntPoint RegionSize(SourceRect.Width() & ~1, SourceRect.Height());
+
+		Output.bIsInsideSource = (RegionSize.X >= 2) && (RegionSize.Y >= 1);
+		if (Output.bIsInsideSource == false)
+			continue;
+
+		Output.SourceRect = FIntRect(SourceRect.Min, SourceRect.Min + RegionSize);
+		Output.TextureLine = TextureHeight;
+
+		Output.VideoFrame.xres = RegionSize.X;
+		Output.VideoFrame.yres = RegionSize.Y;
+		Output.VideoFrame.line_stride_in_bytes = RegionSize.X * 2;
+		Output.VideoFrame.frame_rate_D = FrameRate.Denominator;
+		Output.VideoFrame.frame_rate_N = FrameRate.Numerator;
+		Output.VideoFrame.FourCC = NDIlib_FourCC_type_UYVY;
+
+		TextureWidth = FMath::Max(TextureWidth, RegionSize.X / 2);
+		TextureHeight += RegionSize.Y;
+	}
+
+	if (TextureHeight > 0)
+	{
+		FIntPoint TextureSize(TextureWidth, TextureHeight);
+		this->RegionReadbackTextures.Create(TextureSize);
+		RegionRenderTargetDescriptor = FPooledRenderTargetDesc::Create2DDesc(TextureSize, PF_B8G8R8A8, FClearValueBinding::None,
+		                                                                     TexCreate_None, TexCreate_RenderTargetable, false);
+	}
+	else
+	{
+		this->RegionReadbackTextures.Destroy();
+		RegionRenderTargetDescriptor.Reset();
+	}
+
+	LastRegionSlot = -1;
+}
+
+/**
+	Returns the name under which the stream of an output region is seen on the network
+*/
+FString UNDIMediaSender::GetRegionSourceName(int32 RegionIndex) const
+{
+	const FString& RegionName = OutputRegions[RegionIndex].Name;
+	if (RegionName.IsEmpty())
+		return FString::Printf(TEXT("%s (Region %d)"), *this->SourceName, RegionIndex + 1);
+
+	return this->SourceName + TEXT(" (") + RegionName + TEXT(")");
+}
+
+/**
+	Converts the output regions which have receivers, and sends a frame on each of their streams
+*/
+void UNDIMediaSender::TrySendRegionVideoFrames(int64 time_code)
+{
+	check(RenderSendThreadId == FPlatformTLS::GetCurrentThreadId());
+
+	// The region streams send at most one frame per frame duration
+	int64 RegionSlot = (time_code * FrameRate.Numerator) / ((int64)FrameRate.Denominator * ETimespan::TicksPerSecond);
+	if (RegionSlot == LastRegionSlot)
+		return;
+
+	// Get the command list interface
+	FRHICommandListImmediate& RHICmdList = FRHICommandListExecutor::GetImmediateCommandList();
+
+	// The output regions are cut from the input texture, so they are laid out again when it changes size
+	FTexture2DRHIRef SourceTexture = GetInputTextureRHI();
+	bool bHasInput = SourceTexture.IsValid();
+	if (bHasInput && (SourceTexture->GetSizeXY() != RegionSourceSize))
+		ConfigureRegions(RHICmdList);
+
+	// Only the regions with receivers are converted, so the cost follows the number of pixels sent
+	bool bIsAnyRegionDrawn = false;
+	for (FRegionOutput& Output : RegionOutputs)
+	{
+		bool bHasSource = (Output.StreamKey != nullptr) ? Output.InputTexture.IsValid() : bHasInput;
+		Output.bIsDrawn = (Output.p_send_instance != nullptr) && (Output.bIsInsideSource == true) && bHasSource &&
+		                  (NDIlib_send_get_no_connections(Output.p_send_instance, 0) > 0);
+		bIsAnyRegionDrawn |= Output.bIsDrawn;
+	}
+
+	if (bIsAnyRegionDrawn == false)
+		return;
+
+	if (DrawRegionRenderTarget(RHICmdList))
+	{
+		int32 Width = 0, Height = 0;
+
+		// Map the staging surface once for all the region streams
+		RegionReadbackTextures.Map(RHICmdList, Width, Height);
+
+		// The mapped width may be padded, so follow it for the line stride
+		int32 LineStride = FMath::Max(Width, RegionReadbackTextures.GetSizeXY().X) * 4;
+		uint8* MappedData = const_cast<uint8*>(RegionReadbackTextures.GetMappedData());
+
+		for (FRegionOutput& Output : RegionOutputs)
+		{
+			if (Output.bIsDrawn == true)
+			{
+				Output.VideoFrame.p_data = MappedData + (int64)Output.TextureLine * LineStride;
+				Output.VideoFrame.line_stride_in_bytes = LineStride;
+				Output.VideoFrame.timecode = time_code;
+				Output.VideoFrame.p_metadata = nullptr;
+
+				NDIlib_send_send_video_async_v2(Output.p_send_instance, &Output.VideoFrame);
+				Output.bHasPendingFrame = true;
+			}
+			else if (Output.bHasPendingFrame == true)
+			{
+				// This stream may still use the texture sent before, which is about to be unmapped
+				NDIlib_send_send_video_async_v2(Output.p_send_instance, nullptr);
+				Output.bHasPendingFrame = false;
+			}
+		}
+
+		// Every stream has moved on from the texture sent before, so it can be unmapped
+		RegionReadbackTextures.Advance(RHICmdList);
+
+		LastRegionSlot = RegionSlot;
+	}
+}
+
+/**
+	Perform the color conversion to UYVY of the output regions and texture streams with receivers into the shared
+	conversion texture, in a single render pass, and bit copy from the gpu
+*/
+bool UNDIMediaSender::DrawRegionRenderTarget(FRHICommandListImmediate& RHICmdList)
+{
+	FTexture2DRHIRef SourceTexture = GetInputTextureRHI();
+
+	TRefCountPtr<IPooledRenderTarget> RenderTargetTexturePooled;
+
+	// Find a free target-able texture from the render pool
+	GRenderTargetPool.FindFreeElement(RHICmdList, RegionRenderTargetDescriptor, RenderTargetTexturePooled, TEXT("NDIIO Regions"));
+
+#if ENGINE_MAJOR_VERSION >= 5
+	FRHITexture* TargetableTexture = RenderTargetTexturePooled->GetRHI();
+	FBufferRHIRef VertexBuffer = CreatePlaneVertexBuffer(RHICmdList, 0, 1);
+#elif ENGINE_MAJOR_VERSION == 4
+	FRHITexture* TargetableTexture = RenderTargetTexturePooled->GetRenderTargetItem().TargetableTexture.GetReference();
+	FVertexBufferRHIRef VertexBuffer = CreatePlaneVertexBuffer(0, 1);
+#else
+	#error "Unsupported engine major version"
+#endif
+
+	FGlobalShaderMap* ShaderMap = GetGlobalShaderMap(GMaxRHIFeatureLevel);
+
+	TShaderMapRef<FNDIIOShaderVS> VertexShader(ShaderMap);
+	TShaderMapRef<FNDIIOShaderBGRAtoUYVYPS> ConvertShader(ShaderMap);
+
+	FGraphicsPipelineStateInitializer GraphicsPSOInit;
+
+	FRHIRenderPassInfo RPInfo(TargetableTexture, ERenderTargetActions::DontLoad_Store);
+	RHICmdList.BeginRenderPass(RPInfo, TEXT("NDI Send Region Conversion"));
+
+	RHICmdList.ApplyCachedRenderTargets(GraphicsPSOInit);
+	GraphicsPSOInit.DepthStencilState = TStaticDepthStencilState<false, CF_Always>::GetRHI();
+	GraphicsPSOInit.RasterizerState = TStaticRasterizerState<>::GetRHI();
+	GraphicsPSOInit.BlendState = TStaticBlendStateWriteMask<CW_RGBA, CW_NONE, CW_NONE, CW_NONE, CW_NONE,
+	                                                        CW_NONE, CW_NONE, CW_NONE>::GetRHI();
+	GraphicsPSOInit.BoundShaderState.VertexDeclarationRHI = GMediaVertexDeclaration.VertexDeclarationRHI;
+	GraphicsPSOInit.BoundShaderState.VertexShaderRHI = VertexShader.GetVertexShader();
+	GraphicsPSOInit.BoundShaderState.PixelShaderRHI = ConvertShader.GetPixelShader();
+	GraphicsPSOInit.PrimitiveType = PT_TriangleStrip;
+
+#if ENGINE_MAJOR_VERSION >= 5
+	SetGraphicsPipelineState(RHICmdList, GraphicsPSOInit, 0);
+#elif ENGINE_MAJOR_VERSION == 4
+	SetGraphicsPipelineState(RHICmdList, GraphicsPSOInit);
+#else
+	#error "Unsupported engine major version"
+#endif
+
+	RHICmdList.SetStreamSource(0, VertexBuffer, 0);
+
+	FNDIIOShaderPS::Params Params(SourceTexture, DefaultVideoTextureRHI, FIntPoint(2, 2),
+	                              FVector2D(0.0f, 0.0f), FVector2D(1.0f, 1.0f),
+	                              bPerformLinearTosRGB ? FNDIIOShaderPS::EColorCorrection::LinearTosRGB : FNDIIOShaderPS::EColorCorrection::None,
+	                              FVector2D(this->AlphaMin, this->AlphaMax));
+
+	for (const FRegionOutput& Output : RegionOutputs)
+	{
+		if (Output.bIsDrawn == false)
+			continue;
+
+		// Each region is cut from the source without scaling, into its own band of lines of the conversion texture
+		FIntPoint RegionSize = Output.SourceRect.Size();
+		RHICmdList.SetViewport(0.0f, (float)Output.TextureLine, 0.0f,
+		                       (float)(RegionSize.X / 2), (float)(Output.TextureLine + RegionSize.Y), 1.0f);
+
+		Params.OutputSize = RegionSize;
+		if (Output.StreamKey != nullptr)
+		{
+			// A texture stream is its whole texture, scaled to the frame size of the stream
+			Params.InputTarget = Output.InputTexture;
+			Params.UVOffset = FVector2D(0.0f, 0.0f);
+			Params.UVScale = FVector2D(1.0f, 1.0f);
+		}
+		else
+		{
+			FIntPoint SourceSize = SourceTexture->GetSizeXY();
+			Params.InputTarget = SourceTexture;
+			Params.UVOffset = FVector2D(Output.SourceRect.Min.X / (float)SourceSize.X, Output.SourceRect.Min.Y / (float)SourceSize.Y);
+			Params.UVScale = FVector2D(RegionSize.X / (float)SourceSize.X, RegionSize.Y / (float)SourceSize.Y);
+		}
+		ConvertShader->SetParameters(RHICmdList, Params);
+
+		RHICmdList.DrawPrimitive(0, 2, 1);
+	}
+
+	// Release the reference to the source texture from the shader, as it may be the viewport's backbuffer
+	Params.InputTarget = DefaultVideoTextureRHI;
+	ConvertShader->SetParameters(RHICmdList, Params);
+
+	RHICmdList.EndRenderPass();
+
+	RegionReadbackTextures.Resolve(RHICmdList, TargetableTexture);
+
+	// Force all the drawing to be done here and now
+	RHICmdList.ImmediateFlush(EImmediateFlushType::FlushRHIThreadFlushResources);
+
+	return true;
+}
+
+/**
+	Starts the output clock if needed, and determines the output frame for an engine frame rendered at NowCycles.
+	Returns false when the output frame has already been sent, in which case the engine frame is decimated.
+*/
+bool UNDIMediaSender::SchedulePacedFrame(int64 time_code, uint64 NowCycles, int64& OutSlot)
+{
+	if (bIsPacingClockRunning == false)
+	{
+		// The output clock starts with the first frame sent
+		PacingClockStartCycles = NowCycles;
+		PacingTimecodeBase = time_code;
+		PacingLastSlot = -1;
+		PacingLastSendSlot = -1;
+		PacingRepeatCount = 0;
+		bIsPacingClockRunning = true;
+
+		StartPacingThread();
+	}
+
+	OutSlot = GetPacingSlot(NowCycles);
+
+	if (OutSlot <= PacingLastSlot)
+	{
+		PerformanceData.DecimatedVideoFrames++;
+		return false;
+	}
+
+	return true;
+}
+
+/**
+	Returns the output frame of the paced output clock at NowCycles. Output frame n starts exactly
+	n * Denominator / Numerator seconds after the clock started; this is computed in double precision, since the
+	product of the elapsed cycles and the frame rate numerator overflows 64 bits within hours
+*/
+int64 UNDIMediaSender::GetPacingSlot(uint64 NowCycles) const
+{
+	double ElapsedSeconds = (NowCycles - PacingClockStartCycles) * FPlatformTime::GetSecondsPerCycle64();
+	return (int64)FMath::FloorToDouble(ElapsedSeconds * FrameRate.Numerator / FrameRate.Denominator);
+}
+
+/**
+	Returns the cycle count at which an output frame of the paced output clock starts
+*/
+uint64 UNDIMediaSender::GetPacingSlotStartCycles(int64 Slot) const
+{
+	double SlotSeconds = (double)Slot * FrameRate.Denominator / FrameRate.Numerator;
+	return PacingClockStartCycles + (uint64)FMath::CeilToDouble(SlotSeconds / FPlatformTime::GetSecondsPerCycle64());
+}
+
+/**
+	Returns the exact timecode (in 100ns units) of an output frame of the paced output clock
+*/
+int64 UNDIMediaSender::GetPacedTimecode(int64 Slot) const
+{
+	// Split the slot in whole periods of Numerator frames, so that the intermediate products cannot overflow
+	const int64 Numerator = FrameRate.Numerator;
+	const int64 PeriodTicks = (int64)FrameRate.Denominator * ETimespan::TicksPerSecond;
+	return PacingTimecodeBase + (Slot / Numerator) * PeriodTicks + ((Slot % Numerator) * PeriodTicks) / Numerator;
+}
+
+/**
+	Accounts for the output frames up to Slot, counting those which were neither sent nor repeated as skipped
+*/
+void UNDIMediaSender::ClaimPacedSlot(int64 Slot)
+{
+	if ((PacingLastSlot >= 0) && (Slot > PacingLastSlot + 1))
+		PerformanceData.SkippedVideoFrames += Slot - PacingLastSlot - 1;
+
+	PacingLastSlot = Slot;
+}
+
+/**
+	Records that the frame for Slot has been sent, and updates the cadence statistics
+*/
+void UNDIMediaSender::CompletePacedFrame(int64 Slot, uint64 NowCycles)
+{
+	if (PacingLastSendSlot >= 0)
+	{
+		// Compare the time elapsed since the previous frame was sent with how far apart their output frames are
+		double ExpectedSeconds = (Slot - PacingLastSendSlot) * FrameRate.AsInterval();
+		double ActualSeconds = (NowCycles - PacingLastSendCycles) * FPlatformTime::GetSecondsPerCycle64();
+		float CadenceError = (float)(FMath::Abs(ActualSeconds - ExpectedSeconds) * 1000.0);
+
+		++PacingCadenceSamples;
+		PerformanceData.AverageCadenceError += (CadenceError - PerformanceData.AverageCadenceError) / PacingCadenceSamples;
+		PerformanceData.MaximumCadenceError = FMath::Max(PerformanceData.MaximumCadenceError, CadenceError);
+	}
+
+	ClaimPacedSlot(Slot);
+	PacingLastSendSlot = Slot;
+	PacingLastSendCycles = NowCycles;
+	PacingRepeatCount = 0;
+	PerformanceData.VideoFrames++;
+}
+
+/**
+	Stops the output clock, it will restart with the next frame sent
+*/
+void UNDIMediaSender::ResetFramePacing()
+{
+	bIsPacingClockRunning = false;
+	PacingLastSlot = -1;
+	PacingLastSendSlot = -1;
+	PacingRepeatCount = 0;
+}
+
+/**
+	Starts the pacing worker, or wakes it up if it is already running, as the output clock starts. Called with the
+	render sync context held.
+*/
+void UNDIMediaSender::StartPacingThread()
+{
+	if (bIsPacingThreadRunning)
+	{
+		PacingWakeEvent->Trigger();
+		return;
+	}
+
+	if (PacingWakeEvent == nullptr)
+		PacingWakeEvent = FPlatformProcess::GetSynchEventFromPool(false);
+
+	bIsPacingThreadRunning = true;
+	PacingThread = Async(EAsyncExecution::Thread, [this]() { this->RunPacingThread(); });
+}
+
+/**
+	Stops the pacing worker and waits for it to finish. Must not be called with the render sync context held,
+	since the worker takes it to send the repeated frames.
+*/
+void UNDIMediaSender::StopPacingThread()
+{
+	if (PacingThread.IsValid())
+	{
+		bIsPacingThreadRunning = false;
+		PacingWakeEvent->Trigger();
+
+		PacingThread.Wait();
+		PacingThread = TFuture<void>();
+	}
+
+	if (PacingWakeEvent != nullptr)
+	{
+		FPlatformProcess::ReturnSynchEventToPool(PacingWakeEvent);
+		PacingWakeEvent = nullptr;
+	}
+}
+
+/**
+	Body of the pacing worker: sleeps until the end of the next output frame not accounted for yet, and repeats the
+	previous frame if the engine has not sent a frame for it by then. While the output clock is stopped, it sleeps
+	until the clock starts again or the worker is stopped.
+*/
+void UNDIMediaSender::RunPacingThread()
+{
+	// The longest sleep (in milliseconds) while the output clock runs, in case the frame rate changes meanwhile
+	static const uint32 max_wait_time = 100;
+
+	while (bIsPacingThreadRunning)
+	{
+		uint32 WaitTime = MAX_uint32;
+
+		{
+			FScopeLock Lock(&RenderSyncContext);
+
+			uint64 NowCycles = FPlatformTime::Cycles64();
+			SendPacedRepeat(NowCycles);
+
+			if ((bEnableFramePacing == true) && (bIsPacingClockRunning == true) && (PacingLastSlot >= 0))
+			{
+				uint64 WakeCycles = GetPacingSlotStartCycles(PacingLastSlot + 2);
+				double WaitSeconds = (WakeCycles > NowCycles) ? (WakeCycles - NowCycles) * FPlatformTime::GetSecondsPerCycle64() : 0.0;
+				WaitTime = FMath::Clamp<uint32>((uint32)FMath::CeilToDouble(WaitSeconds * 1000.0), 1, max_wait_time);
+			}
+		}
+
+		PacingWakeEvent->Wait(WaitTime);
+	}
+}
+
+/**
+	Repeats the previous frame for the latest output frame which has ended without a frame sent for it, up to
+	MaxRepeatedFrames times in a row. Called by the pacing worker with the render sync context held.
+*/
+void UNDIMediaSender::SendPacedRepeat(uint64 NowCycles)
+{
+	if ((p_send_instance == nullptr) || bIsChangingBroadcastSize || (bEnableFramePacing == false) ||
+		(bIsPacingClockRunning == false) || (PacingLastSlot < 0))
+		return;
+
+	int64 EndedSlot = GetPacingSlot(NowCycles) - 1;
+	if (EndedSlot <= PacingLastSlot)
+		return;
+
+	if (PacingRepeatCount < FMath::Max(this->MaxRepeatedFrames, 0))
+	{
+		NDIlib_video_frame_v2_t RepeatedFrame = NDI_video_frame;
+		RepeatedFrame.p_metadata = nullptr;
+		RepeatedFrame.timecode = GetPacedTimecode(EndedSlot);
+
+		if (ReadbackTextures.Resend(p_send_instance, RepeatedFrame) == true)
+		{
+			ClaimPacedSlot(EndedSlot);
+			PacingLastSendSlot = EndedSlot;
+			PacingLastSendCycles = NowCycles;
+			LastVideoSendCycles = NowCycles;
+			++PacingRepeatCount;
+			PerformanceData.RepeatedVideoFrames++;
+			return;
+		}
+	}
+
+	// The output frame is skipped instead
+	ClaimPacedSlot(EndedSlot);
+	PerformanceData.SkippedVideoFrames++;
+}
+
+/**
+	Returns the current performance data of the sender
+*/
+const FNDISenderPerformanceData& UNDIMediaSender::GetPerformanceData() const
+{
+	return this->PerformanceData;
+}
+
+/**
+	Perform the color conversion (if any) and bit copy from the gpu
+*/
+bool UNDIMediaSender::DrawRenderTarget(FRHICommandListImmediate& RHICmdList)
+{
+	bool DrawResult = false;
+
+	// We should only do conversions and pixel copies, if we have something to work with
+	if (!bIsChangingBroadcastSize)
+	{
+		// Get the underlying texture to use for the color conversion
+		FTexture2DRHIRef SourceTexture = GetInputTextureRHI();
+
+		// Validate the Source Texture
+		if (SourceTexture.IsValid())
+		{
+			// We have something to draw
+			DrawResult = true;
+
+			TRefCountPtr<IPooledRenderTarget> RenderTargetTexturePooled;
+
+			// Find a free target-able texture from the render pool
+			GRenderTargetPool.FindFreeElement(RHICmdList, RenderTargetDescriptor, RenderTargetTexturePooled, TEXT("NDIIO"));
+
+#if ENGINE_MAJOR_VERSION >= 5
+			FRHITexture* TargetableTexture = RenderTargetTexturePooled->GetRHI();
+#elif ENGINE_MAJOR_VERSION == 4
+			FRHITexture* TargetableTexture = RenderTargetTexturePooled->GetRenderTargetItem().TargetableTexture.GetReference();
+#else
+			#error "Unsupported engine major version"
+#endif
+
+			// Get the target size of the conversion
+			FIntPoint TargetSize = SourceTexture->GetSizeXY();
+
+			// Calculate the rectangle in which to draw the source, maintaining aspect ratio
+			float FrameRatio = FrameSize.X / (float)FrameSize.Y;
+			float TargetRatio = TargetSize.X / (float)TargetSize.Y;
+
+			FIntPoint NewFrameSize = FrameSize;
+
+			if (TargetRatio > FrameRatio)
+			{
+				// letterbox
+				NewFrameSize.Y = FMath::RoundToInt(FrameSize.X / TargetRatio);
+			}
+			else if (TargetRatio < FrameRatio)
+			{
+				// pillarbox
+				NewFrameSize.X = FMath::RoundToInt(FrameSize.Y * TargetRatio);
+			}
+
+			float ULeft   = (NewFrameSize.X - FrameSize.X) / (float)(2*NewFrameSize.X);
+			float URight  = (NewFrameSize.X + FrameSize.X) / (float)(2*NewFrameSize.X);
+			float VTop    = (NewFrameSize.Y - FrameSize.Y) / (float)(2*NewFrameSize.Y);
+			float VBottom = (NewFrameSize.Y + FrameSize.Y) / (float)(2*NewFrameSize.Y);
+
+#if ENGINE_MAJOR_VERSION >= 5
+			FBufferRHIRef ColorVertexBuffer = CreateColorVertexBuffer(RHICmdList, FrameSize, NewFrameSize, this->OutputAlpha);
+			FBufferRHIRef AlphaEvenVertexBuffer = CreateAlphaEvenVertexBuffer(RHICmdList, FrameSize, NewFrameSize, this->OutputAlpha);
+			FBufferRHIRef AlphaOddVertexBuffer = CreateAlphaOddVertexBuffer(RHICmdList, FrameSize, NewFrameSize, this->OutputAlpha);
+#elif ENGINE_MAJOR_VERSION == 4
+			FVertexBufferRHIRef ColorVertexBuffer = CreateColorVertexBuffer(FrameSize, NewFrameSize, this->OutputAlpha);
+			FVertexBufferRHIRef AlphaEvenVertexBuffer = CreateAlphaEvenVertexBuffer(FrameSize, NewFrameSize, this->OutputAlpha);
+			FVertexBufferRHIRef AlphaOddVertexBuffer = CreateAlphaOddVertexBuffer(FrameSize, NewFrameSize, this->OutputAlpha);
+#else
+			#error "Unsupported engine major version"
+#endif
+
+			// Initialize the Graphics Pipeline State Object
+			FGraphicsPipelineStateInitializer GraphicsPSOInit;
+
+			// Configure shaders
+			FGlobalShaderMap* ShaderMap = GetGlobalShaderMap(GMaxRHIFeatureLevel);
+
+			// Construct the shaders
+			TShaderMapRef<FNDIIOShaderVS> VertexShader(ShaderMap);
+			TShaderMapRef<FNDIIOShaderBGRAtoUYVYPS> ConvertShader(ShaderMap);
+			TShaderMapRef<FNDIIOShaderBGRAtoAlphaEvenPS> ConvertAlphaEvenShader(ShaderMap);
+			TShaderMapRef<FNDIIOShaderBGRAtoAlphaOddPS> ConvertAlphaOddShader(ShaderMap);
+
+			// Scaled drawing pass with conversion to UYVY
+			if (this->ReadbackTexturesAre16Bit == false)
+			{
+				// Initialize the Render pass with the conversion texture
+				FRHITexture* ConversionTexture = TargetableTexture;
+				FRHIRenderPassInfo RPInfo(ConversionTexture, ERenderTargetActions::DontLoad_Store);
+
+				RHICmdList.BeginRenderPass(RPInfo, TEXT("NDI Send Scaling Conversion"));
+
+				// Do as it suggests
+				RHICmdList.ApplyCachedRenderTargets(GraphicsPSOInit);
+				// Set the state objects
+				GraphicsPSOInit.DepthStencilState = TStaticDepthStencilState<false, CF_Always>::GetRHI();
+				GraphicsPSOInit.RasterizerState = TStaticRasterizerState<>::GetRHI();
+				GraphicsPSOInit.BlendState = TStaticBlendStateWriteMask<CW_RGBA, CW_NONE, CW_NONE, CW_NONE, CW_NONE,
+																		CW_NONE, CW_NONE, CW_NONE>::GetRHI();
+				// Perform binding operations for the shaders to be used
+				GraphicsPSOInit.BoundShaderState.VertexDeclarationRHI = GMediaVertexDeclaration.VertexDeclarationRHI;
+				GraphicsPSOInit.BoundShaderState.VertexShaderRHI = VertexShader.GetVertexShader();
+				GraphicsPSOInit.BoundShaderState.PixelShaderRHI = ConvertShader.GetPixelShader();
+				// Going to draw triangle strips
+				GraphicsPSOInit.PrimitiveType = PT_TriangleStrip;
+
+				// Ensure the pipeline state is set to the one we've configured
+#if ENGINE_MAJOR_VERSION >= 5
+				SetGraphicsPipelineState(RHICmdList, GraphicsPSOInit, 0);
+#elif ENGINE_MAJOR_VERSION == 4
+				SetGraphicsPipelineState(RHICmdList, GraphicsPSOInit);
+#else
+				#error "Unsupported engine major version"
+#endif
+
+				// Set the stream source
+				RHICmdList.SetStreamSource(0, ColorVertexBuffer, 0);
+
+				// Set the texture parameter of the conversion shader
+				FNDIIOShaderBGRAtoUYVYPS::Params Params(SourceTexture, DefaultVideoTextureRHI, FrameSize,
+				                                        FVector2D(ULeft, VTop), FVector2D(URight-ULeft, VBottom-VTop),
+				                                        bPerformLinearTosRGB ? FNDIIOShaderPS::EColorCorrection::LinearTosRGB : FNDIIOShaderPS::EColorCorrection::None,
+				                                        FVector2D(this->AlphaMin, this->AlphaMax));
+				ConvertShader->SetParameters(RHICmdList, Params);
+
+				// Draw the texture
+				RHICmdList.DrawPrimitive(0, 2, 1);
+
+				// Release the reference to SourceTexture from the shader
+				// The SourceTexture may be the viewport's backbuffer, and Unreal does not like
+				// extra references to the backbuffer when the viewport is resized
+				Params.InputTarget = DefaultVideoTextureRHI;
+				ConvertShader->SetParameters(RHICmdList, Params);
 
 				RHICmdList.EndRenderPass();
 			}
 
 			// Scaled drawing pass with conversion to the alpha part of UYVA
-			if (this->OutputAlpha == true)
+			if ((this->ReadbackTexturesAre16Bit == false) && (this->OutputAlpha == true))
 			{
 				// Alpha even-numbered lines
 				{
@@ -890,6 +2156,49 @@ bool UNDIMediaSender::DrawRenderTarget(FRHICommandListImmediate& RHICmdList)
 				}
 			}
 
+			// Scaled drawing passes with conversion to the 16 bits planes of P216, and the alpha plane of PA16
+			if (this->ReadbackTexturesAre16Bit == true)
+			{
+				int32 NumPlanes = this->ReadbackTexturesHaveAlpha ? 3 : 2;
+
+#if ENGINE_MAJOR_VERSION >= 5
+				FBufferRHIRef LumaVertexBuffer = CreatePlaneVertexBuffer(RHICmdList, 0, NumPlanes);
+				FBufferRHIRef ChromaVertexBuffer = CreatePlaneVertexBuffer(RHICmdList, 1, NumPlanes);
+#elif ENGINE_MAJOR_VERSION == 4
+				FVertexBufferRHIRef LumaVertexBuffer = CreatePlaneVertexBuffer(0, NumPlanes);
+				FVertexBufferRHIRef ChromaVertexBuffer = CreatePlaneVertexBuffer(1, NumPlanes);
+#else
+				#error "Unsupported engine major version"
+#endif
+
+				FNDIIOShaderPS::Params Params(SourceTexture, DefaultVideoTextureRHI, FrameSize,
+				                              FVector2D(ULeft, VTop), FVector2D(URight-ULeft, VBottom-VTop),
+				                              bPerformLinearTosRGB ? FNDIIOShaderPS::EColorCorrection::LinearTosRGB : FNDIIOShaderPS::EColorCorrection::None,
+				                              FVector2D(this->AlphaMin, this->AlphaMax));
+
+				DrawConversionPass<FNDIIOShaderBGRAtoY16PS>(RHICmdList, TargetableTexture, ERenderTargetActions::DontLoad_Store,
+				                                          LumaVertexBuffer, Params, DefaultVideoTextureRHI);
+				DrawConversionPass<FNDIIOShaderBGRAtoCbCr16PS>(RHICmdList, TargetableTexture, ERenderTargetActions::Load_Store,
+				                                             ChromaVertexBuffer, Params, DefaultVideoTextureRHI);
+
+				if (this->ReadbackTexturesHaveAlpha == true)
+				{
+#if ENGINE_MAJOR_VERSION >= 5
+					FBufferRHIRef AlphaVertexBuffer = CreatePlaneVertexBuffer(RHICmdList, 2, NumPlanes);
+#elif ENGINE_MAJOR_VERSION == 4
+					FVertexBufferRHIRef AlphaVertexBuffer = CreatePlaneVertexBuffer(2, NumPlanes);
+#else
+					#error "Unsupported engine major version"
+#endif
+
+					DrawConversionPass<FNDIIOShaderBGRAtoA16PS>(RHICmdList, TargetableTexture, ERenderTargetActions::Load_Store,
+					                                          AlphaVertexBuffer, Params, DefaultVideoTextureRHI);
+				}
+
+				// Release the reference to SourceTexture held by the parameters
+				Params.InputTarget = DefaultVideoTextureRHI;
+			}
+
 			// Copy to resolve target...
 			// This is by far the most expensive in terms of cost, since we are having to pull
 			// data from the gpu, while in the render thread.
@@ -917,25 +2226,91 @@ void UNDIMediaSender::ChangeRenderTargetConfiguration(FIntPoint InFrameSize, FFr
 	this->FrameSize = InFrameSize;
 	this->FrameRate = InFrameRate;
 
+	// The output clock runs at the frame rate, so restart it
+	ResetFramePacing();
+
 	// Reiterate the properties that the frame needs to be when sent
 	NDI_video_frame.xres = FrameSize.X;
 	NDI_video_frame.yres = FrameSize.Y;
 	NDI_video_frame.line_stride_in_bytes = FrameSize.X * 2;
 	NDI_video_frame.frame_rate_D = FrameRate.Denominator;
 	NDI_video_frame.frame_rate_N = FrameRate.Numerator;
-	NDI_video_frame.FourCC = this->OutputAlpha ?  NDIlib_FourCC_type_UYVA : NDIlib_FourCC_type_UYVY;
 
-	// Size of the readback texture in UYVY format, optionally with alpha
-	FIntPoint UYVYTextureSize(FrameSize.X/2, FrameSize.Y + (this->OutputAlpha ? FrameSize.Y/2 : 0));
+	FIntPoint ReadbackTextureSize;
+	EPixelFormat ReadbackPixelFormat;
+
+	if (this->bOutput16Bit == true)
+	{
+		// P216 is a 16 bits luma plane followed by an interleaved 16 bits CbCr plane, with PA16 adding a 16 bits
+		// alpha plane. Every plane has the same line stride as UYVY, so a two-channel 16 bits texture half the
+		// frame width holds each plane as a band of FrameSize.Y lines
+		NDI_video_frame.FourCC = this->OutputAlpha ? NDIlib_FourCC_type_PA16 : NDIlib_FourCC_type_P216;
+
+		ReadbackTextureSize = FIntPoint(FrameSize.X/2, FrameSize.Y * (this->OutputAlpha ? 3 : 2));
+		ReadbackPixelFormat = PF_G16R16;
+	}
+	else
+	{
+		NDI_video_frame.FourCC = this->OutputAlpha ?  NDIlib_FourCC_type_UYVA : NDIlib_FourCC_type_UYVY;
+
+		// Size of the readback texture in UYVY format, optionally with alpha
+		ReadbackTextureSize = FIntPoint(FrameSize.X/2, FrameSize.Y + (this->OutputAlpha ? FrameSize.Y/2 : 0));
+		ReadbackPixelFormat = PF_B8G8R8A8;
+	}
 
-	// Create readback textures, suitably sized for UYVY
-	this->ReadbackTextures.Create(UYVYTextureSize);
+	// Create readback textures, suitably sized for the output format
+	this->ReadbackTextures.Create(ReadbackTextureSize, ReadbackPixelFormat);
 	this->ReadbackTexturesHaveAlpha = this->OutputAlpha;
+	this->ReadbackTexturesAre16Bit = this->bOutput16Bit;
 
-	// Create the RenderTarget descriptor, suitably sized for UYVY
-	RenderTargetDescriptor = FPooledRenderTargetDesc::Create2DDesc(UYVYTextureSize, PF_B8G8R8A8, FClearValueBinding::None,
+	// Create the RenderTarget descriptor, suitably sized for the output format
+	RenderTargetDescriptor = FPooledRenderTargetDesc::Create2DDesc(ReadbackTextureSize, ReadbackPixelFormat, FClearValueBinding::None,
 	                                                               TexCreate_None, TexCreate_RenderTargetable, false);
 
+	// The proxy stream is plain UYVY at its own size, never larger than the main stream
+	FIntPoint ProxySize(FMath::Clamp(this->ProxyFrameSize.X, 2, FMath::Max(FrameSize.X, 2)) & ~1,
+	                    FMath::Clamp(this->ProxyFrameSize.Y, 2, FMath::Max(FrameSize.Y, 2)));
+	this->EffectiveProxyFrameSize = ProxySize;
+
+	NDI_proxy_video_frame.xres = ProxySize.X;
+	NDI_proxy_video_frame.yres = ProxySize.Y;
+	NDI_proxy_video_frame.line_stride_in_bytes = ProxySize.X * 2;
+	NDI_proxy_video_frame.frame_rate_D = ProxyFrameRate.Denominator;
+	NDI_proxy_video_frame.frame_rate_N = ProxyFrameRate.Numerator;
+	NDI_proxy_video_frame.FourCC = NDIlib_FourCC_type_UYVY;
+
+	// The proxy readback textures may still be mapped for sending, release them first
+	if (p_proxy_send_instance != nullptr)
+		this->ProxyReadbackTextures.Flush(FRHICommandListExecutor::GetImmediateCommandList(), p_proxy_send_instance);
+
+	FIntPoint ProxyTextureSize(ProxySize.X/2, ProxySize.Y);
+	this->ProxyReadbackTextures.Create(ProxyTextureSize);
+	ProxyRenderTargetDescriptor = FPooledRenderTargetDesc::Create2DDesc(ProxyTextureSize, PF_B8G8R8A8, FClearValueBinding::None,
+	                                                                    TexCreate_None, TexCreate_RenderTargetable, false);
+	LastProxySlot = -1;
+
+	// The fingerprint for detecting unchanged frames is a small grid of hashes of blocks of the input texture
+	if (this->bSkipUnchangedFrames == true)
+	{
+		FIntPoint FingerprintTextureSize(FingerprintSize, FingerprintSize);
+		for (FFingerprintReadback& Readback : this->FingerprintReadbacks)
+		{
+			Readback.Texture.Create(FingerprintTextureSize, PF_R32_UINT);
+			Readback.bIsPending = false;
+			Readback.bWasSent = false;
+		}
+		FingerprintRenderTargetDescriptor = FPooledRenderTargetDesc::Create2DDesc(FingerprintTextureSize, PF_R32_UINT, FClearValueBinding::None,
+		                                                                          TexCreate_None, TexCreate_RenderTargetable, false);
+	}
+	LastFingerprint.Reset();
+
+	// The region streams run at the frame rate of the sender, and are clamped to the frame
+	ENQUEUE_RENDER_COMMAND(NDIMediaSender_ConfigureRegionsRT)([this](FRHICommandListImmediate& RHICmdList)
+	{
+		FScopeLock RegionLock(&RenderSyncContext);
+		this->ConfigureRegions(RHICmdList);
+	});
+
 	// If our RenderTarget is valid change the size
 	if (IsValid(this->RenderTarget))
 	{
@@ -961,40 +2336,22 @@ void UNDIMediaSender::ChangeRenderTargetConfiguration(FIntPoint InFrameSize, FFr
 */
 void UNDIMediaSender::SendMetadataFrame(const FString& Data, bool AttachToVideoFrame)
 {
-	if (p_send_instance != nullptr)
-	{
-		if(AttachToVideoFrame == true)
-		{
-			// Attach the metadata to the next video frame to be sent
-			FScopeLock RenderLock(&RenderSyncContext);
-			this->ReadbackTextures.AddMetaData(Data);
-		}
-		else
-		{
-			OnSenderMetaDataPreSend.Broadcast(this);
-
-			// Send the metadata separate from the video frame
-			NDIlib_metadata_frame_t metadata;
-			std::string DataStr(TCHAR_TO_UTF8(*Data));
-			metadata.p_data = const_cast<char*>(DataStr.c_str());
-			metadata.length = DataStr.length();
-			metadata.timecode = FDateTime::Now().GetTimeOfDay().GetTicks();
-
-			NDIlib_send_send_metadata(p_send_instance, &metadata);
+	FNDIMetadataBuilder MetaData;
+	MetaData.Append(Data);
 
-			OnSenderMetaDataSent.Broadcast(this);
-		}
-	}
+	SendMetadataFrameUTF8(MetaData, AttachToVideoFrame);
 }
 
 /**
 	This will send a metadata frame to all receivers
-	The data will be formatted as: <Element AttributeData/>
+	The data will be formatted as: <Element>ElementData</Element>
 */
 void UNDIMediaSender::SendMetadataFrameAttr(const FString& Element, const FString& ElementData, bool AttachToVideoFrame)
 {
-	FString Data = "<" + Element + ">" + ElementData + "</" + Element + ">";
-	SendMetadataFrame(Data, AttachToVideoFrame);
+	FNDIMetadataBuilder MetaData;
+	MetaData.AddElement(Element, ElementData);
+
+	SendMetadataFrameUTF8(MetaData, AttachToVideoFrame);
 }
 
 /**
@@ -1003,16 +2360,51 @@ void UNDIMediaSender::SendMetadataFrameAttr(const FString& Element, const FStrin
 */
 void UNDIMediaSender::SendMetadataFrameAttrs(const FString& Element, const TMap<FString,FString>& Attributes, bool AttachToVideoFrame)
 {
-	FString Data = "<" + Element;
-	
+	FNDIMetadataBuilder MetaData;
+	MetaData.OpenElement(Element);
+
 	for(const auto& Attribute : Attributes)
 	{
-		Data += " " + Attribute.Key + "=\"" + Attribute.Value + "\"";
+		MetaData.AddAttribute(Attribute.Key, Attribute.Value);
 	}
 
-	Data += "/>";
+	MetaData.CloseEmptyElement();
+
+	SendMetadataFrameUTF8(MetaData, AttachToVideoFrame);
+}
+
+/**
+	This will send metadata already composed as UTF-8 to all receivers, without any intermediate strings
+	The builder's buffer comes from a shared pool, so composing and sending metadata does not allocate once warm
+*/
+void UNDIMediaSender::SendMetadataFrameUTF8(const FNDIMetadataBuilder& Data, bool AttachToVideoFrame)
+{
+	if (p_send_instance != nullptr)
+	{
+		if(AttachToVideoFrame == true)
+		{
+			// Attach the metadata to the next video frame to be sent
+			FScopeLock RenderLock(&RenderSyncContext);
+			this->ReadbackTextures.AddMetaData(Data);
+		}
+		else
+		{
+			OnSenderMetaDataPreSend.Broadcast(this);
+
+			// Send the metadata separate from the video frame; the SDK copies the data before returning
+			NDIlib_metadata_frame_t metadata;
+			metadata.p_data = const_cast<char*>(Data.GetData());
+			metadata.length = Data.Len();
+			metadata.timecode = FDateTime::Now().GetTimeOfDay().GetTicks();
+
+			NDIlib_send_send_metadata(p_send_instance, &metadata);
+
+			OnSenderMetaDataSent.Broadcast(this);
+		}
 
-	SendMetadataFrame(Data, AttachToVideoFrame);
+		++PerformanceData.MetadataFrames;
+		PerformanceData.MetadataBufferAllocations = FNDIMetadataBufferPool::Get().GetNumAllocations();
+	}
 }
 
 
@@ -1044,6 +2436,139 @@ bool UNDIMediaSender::GetMetadataFrame()
 	return bProcessed;
 }
 
+/**
+	Sends a video frame from CPU memory, converting it to UYVY (UYVA with alpha) on the CPU
+*/
+bool UNDIMediaSender::SendVideoFrameFromCPU(const uint8* Data, EPixelFormat PixelFormat, FIntPoint Size, int32 StrideInBytes, int64 Timecode)
+{
+	if ((Data == nullptr) || (Size.X <= 0) || (Size.Y <= 0) || ((Size.X % 2) != 0))
+		return false;
+
+	int32 BytesPerPixel = 0;
+	if (PixelFormat == PF_B8G8R8A8)
+		BytesPerPixel = 4;
+	else if (PixelFormat == PF_FloatRGBA)
+		BytesPerPixel = 8;
+	else
+		return false;
+
+	if (StrideInBytes <= 0)
+		StrideInBytes = Size.X * BytesPerPixel;
+
+	if ((p_send_instance == nullptr) || bIsChangingBroadcastSize)
+		return false;
+
+	FScopeLock Lock(&RenderSyncContext);
+
+	if (NDIlib_send_get_no_connections(p_send_instance, 0) <= 0)
+		return false;
+
+	// Same alpha remapping as FNDIIOShaderPS::SetParameters
+	float AlphaRange = this->AlphaMax - this->AlphaMin;
+	float AlphaScale = (AlphaRange != 0.f) ? 1.f / AlphaRange : 0.f;
+	float AlphaOffset = (AlphaRange != 0.f) ? -this->AlphaMin / AlphaRange : -this->AlphaMin;
+
+	// UYVY plane with the line stride of UYVY, followed by the alpha plane for UYVA
+	int32 LineStride = Size.X * 2;
+	int32 FrameBytes = LineStride * Size.Y + (this->OutputAlpha ? Size.X * Size.Y : 0);
+	uint8* Buffer = CPUVideoFrames.GetBuffer(FrameBytes);
+
+	for (int32 Y = 0; Y < Size.Y; ++Y)
+	{
+		const uint8* SrcLine = Data + (int64)Y * StrideInBytes;
+		uint8* DstLine = Buffer + (int64)Y * LineStride;
+		uint8* DstAlphaLine = this->OutputAlpha ? (Buffer + (int64)LineStride * Size.Y + (int64)Y * Size.X) : nullptr;
+
+		if (PixelFormat == PF_FloatRGBA)
+		{
+			// Half float pixels are quantized to BGRA8 first, with the same color correction as the shader path
+			CPUConversionLine.SetNumUninitialized(Size.X, false);
+			ConvertHalfLineToBGRA8(reinterpret_cast<const FFloat16Color*>(SrcLine), CPUConversionLine.GetData(), Size.X, bPerformLinearTosRGB);
+			SrcLine = reinterpret_cast<const uint8*>(CPUConversionLine.GetData());
+		}
+
+		ConvertBGRA8LineToUYVA(SrcLine, DstLine, DstAlphaLine, Size.X, AlphaScale, AlphaOffset);
+	}
+
+	NDI_cpu_video_frame.xres = Size.X;
+	NDI_cpu_video_frame.yres = Size.Y;
+	NDI_cpu_video_frame.line_stride_in_bytes = LineStride;
+	NDI_cpu_video_frame.frame_rate_D = FrameRate.Denominator;
+	NDI_cpu_video_frame.frame_rate_N = FrameRate.Numerator;
+	NDI_cpu_video_frame.FourCC = this->OutputAlpha ? NDIlib_FourCC_type_UYVA : NDIlib_FourCC_type_UYVY;
+	NDI_cpu_video_frame.timecode = (Timecode != 0) ? Timecode : NDIlib_send_timecode_synthesize;
+	NDI_cpu_video_frame.p_data = Buffer;
+
+	// Metadata attached to the next video frame goes with this frame
+	ReadbackTextures.MoveMetaData(CPUVideoFrames.GetMetaData());
+
+	OnSenderVideoPreSend.Broadcast(this);
+
+	CPUVideoFrames.Send(p_send_instance, NDI_cpu_video_frame);
+
+	PerformanceData.VideoFrames++;
+
+	OnSenderVideoSent.Broadcast(this);
+
+	return true;
+}
+
+/**
+	Waits until the last frame sent with SendVideoFrameFromCPU has been consumed by the NDI SDK
+*/
+void UNDIMediaSender::WaitForVideoFrameFromCPU()
+{
+	FScopeLock Lock(&RenderSyncContext);
+
+	if (p_send_instance != nullptr)
+		CPUVideoFrames.Flush(p_send_instance);
+}
+
+/**
+	Resumes sending the audio of the submix the sender is routed to, after audio has been sent from CPU memory
+*/
+void UNDIMediaSender::StopSendingAudioFromCPU()
+{
+	FScopeLock Lock(&AudioSyncContext);
+
+	bIsSendingAudioFromCPU = false;
+}
+
+/**
+	Sends interleaved audio from CPU memory, instead of the audio of the submix the sender is routed to
+*/
+bool UNDIMediaSender::SendAudioFrameFromCPU(const float* Data, int32 NumSamples, int32 NumChannels, int32 SampleRate, int64 Timecode)
+{
+	if ((Data == nullptr) || (NumSamples <= 0) || (NumChannels <= 0) || (SampleRate <= 0))
+		return false;
+
+	if (!bEnableAudio || (p_send_instance == nullptr) || bIsChangingBroadcastSize)
+		return false;
+
+	FScopeLock Lock(&AudioSyncContext);
+
+	// The audio of the submix would be mixed up with this audio
+	bIsSendingAudioFromCPU = true;
+
+	if (NDIlib_send_get_no_connections(p_send_instance, 0) <= 0)
+		return false;
+
+	NDIlib_audio_frame_interleaved_32f_t NDI_interleaved_audio_frame;
+	NDI_interleaved_audio_frame.timecode = (Timecode != 0) ? Timecode : NDIlib_send_timecode_synthesize;
+	NDI_interleaved_audio_frame.sample_rate = SampleRate;
+	NDI_interleaved_audio_frame.no_channels = NumChannels;
+	NDI_interleaved_audio_frame.no_samples = NumSamples;
+	NDI_interleaved_audio_frame.p_data = const_cast<float*>(Data);
+
+	OnSenderAudioPreSend.Broadcast(this);
+
+	NDIlib_util_send_send_audio_interleaved_32f(p_send_instance, &NDI_interleaved_audio_frame);
+
+	OnSenderAudioSent.Broadcast(this);
+
+	return true;
+}
+
 /**
 	Attempts to change the RenderTarget used in sending video frames over NDI
 */
@@ -1056,6 +2581,51 @@ void UNDIMediaSender::ChangeVideoTexture(UTextureRenderTarget2D* VideoTexture)
 	this->RenderTarget = VideoTexture;
 }
 
+/**
+	Changes the texture sent over NDI to any texture, instead of the Render Target
+*/
+void UNDIMediaSender::ChangeInputTexture(UTexture* Texture)
+{
+	FScopeLock RenderLock(&RenderSyncContext);
+
+	this->InputTexture = Texture;
+}
+
+/**
+	Changes the texture sent over NDI to an RHI texture of any format, which takes precedence over the
+	Input Texture and the Render Target
+*/
+void UNDIMediaSender::ChangeInputTextureRHI(FRHITexture* Texture)
+{
+	FScopeLock RenderLock(&RenderSyncContext);
+
+	this->InputTextureRHI = Texture;
+}
+
+/**
+	Attempts to change the submix used in sending audio frames over NDI
+*/
+void UNDIMediaSender::ChangeAudioSubmix(USoundSubmix* Submix)
+{
+	// Wait audio thread so that we can do something
+	FScopeLock AudioLock(&AudioSyncContext);
+
+	this->AudioSubmix = Submix;
+
+	// Only listen to the submix while the sender is active, the listener is shared between senders
+	USoundSubmix* NewListenedAudioSubmix = (p_send_instance != nullptr) ? Submix : nullptr;
+	if (NewListenedAudioSubmix != ListenedAudioSubmix)
+	{
+		if (ListenedAudioSubmix != nullptr)
+			FNDIConnectionService::RemoveSubmixListener(ListenedAudioSubmix);
+
+		ListenedAudioSubmix = NewListenedAudioSubmix;
+
+		if (ListenedAudioSubmix != nullptr)
+			FNDIConnectionService::AddSubmixListener(ListenedAudioSubmix);
+	}
+}
+
 /**
 	Change the alpha remapping settings
 */
@@ -1066,6 +2636,86 @@ void UNDIMediaSender::ChangeAlphaRemap(float AlphaMinIn, float AlphaMaxIn)
 
 	this->AlphaMin = AlphaMinIn;
 	this->AlphaMax = AlphaMaxIn;
+
+	// The converted frames change even if the input does not
+	this->LastFingerprint.Reset();
+}
+
+/**
+	Returns the number of bytes in one video frame handed to the NDI encoder for the current output format
+*/
+int32 UNDIMediaSender::GetVideoFrameSizeInBytes() const
+{
+	// All formats use a line stride of twice the width; UYVA adds half a frame of alpha,
+	// P216 has a second full size plane for CbCr and PA16 a third one for alpha
+	int32 NumHalfPlanes = (this->ReadbackTexturesAre16Bit ? 4 : 2) + (this->ReadbackTexturesHaveAlpha ? (this->ReadbackTexturesAre16Bit ? 2 : 1) : 0);
+
+	return NDI_video_frame.line_stride_in_bytes * NDI_video_frame.yres * NumHalfPlanes / 2;
+}
+
+/**
+	CPU reference of the P216/PA16 conversion performed on the GPU, for verifying the GPU output
+*/
+void UNDIMediaSender::ConvertToP216Reference(const TArray<FLinearColor>& Source, FIntPoint Size, bool bWithAlpha,
+                                             FVector2D AlphaMinMax, TArray<uint16>& OutData)
+{
+	check((Size.X % 2) == 0);
+	check(Source.Num() == Size.X * Size.Y);
+
+	// Must match the coefficients of NDIIOBGRAtoY16PS and NDIIOBGRAtoCbCr16PS
+	static const float RGBToYCbCr16Mat[3][3] =
+	{
+		{  0.18188f,  0.61184f,  0.06177f },
+		{ -0.10025f, -0.33725f,  0.43751f },
+		{  0.43751f, -0.39739f, -0.04012f }
+	};
+	static const float RGBToYCbCr16Vec[3] = { 0.06250f, 0.50001f, 0.50001f };
+
+	auto ToYCbCr = [](const FLinearColor& Color, int32 Component) -> float
+	{
+		float R = FMath::Clamp(Color.R, 0.f, 1.f);
+		float G = FMath::Clamp(Color.G, 0.f, 1.f);
+		float B = FMath::Clamp(Color.B, 0.f, 1.f);
+		return RGBToYCbCr16Mat[Component][0] * R + RGBToYCbCr16Mat[Component][1] * G + RGBToYCbCr16Mat[Component][2] * B + RGBToYCbCr16Vec[Component];
+	};
+	auto ToUNorm16 = [](float Value) -> uint16
+	{
+		return (uint16)FMath::RoundToInt(FMath::Clamp(Value, 0.f, 1.f) * 65535.f);
+	};
+
+	// Same alpha remapping as FNDIIOShaderPS::SetParameters
+	float AlphaRange = AlphaMinMax.Y - AlphaMinMax.X;
+	float AlphaScale = (AlphaRange != 0.f) ? 1.f / AlphaRange : 0.f;
+	float AlphaOffset = (AlphaRange != 0.f) ? -AlphaMinMax.X / AlphaRange : -AlphaMinMax.X;
+
+	int32 PlaneSize = Size.X * Size.Y;
+	OutData.SetNumUninitialized(PlaneSize * (bWithAlpha ? 3 : 2));
+
+	uint16* LumaPlane = OutData.GetData();
+	uint16* ChromaPlane = LumaPlane + PlaneSize;
+	uint16* AlphaPlane = ChromaPlane + PlaneSize;
+
+	for (int32 Y = 0; Y < Size.Y; ++Y)
+	{
+		for (int32 X = 0; X < Size.X; X += 2)
+		{
+			int32 Index = Y * Size.X + X;
+			const FLinearColor& Color0 = Source[Index];
+			const FLinearColor& Color1 = Source[Index + 1];
+
+			LumaPlane[Index] = ToUNorm16(ToYCbCr(Color0, 0));
+			LumaPlane[Index + 1] = ToUNorm16(ToYCbCr(Color1, 0));
+
+			ChromaPlane[Index] = ToUNorm16((ToYCbCr(Color0, 1) + ToYCbCr(Color1, 1)) / 2.f);
+			ChromaPlane[Index + 1] = ToUNorm16((ToYCbCr(Color0, 2) + ToYCbCr(Color1, 2)) / 2.f);
+
+			if (bWithAlpha)
+			{
+				AlphaPlane[Index] = ToUNorm16(Color0.A * AlphaScale + AlphaOffset);
+				AlphaPlane[Index + 1] = ToUNorm16(Color1.A * AlphaScale + AlphaOffset);
+			}
+		}
+	}
 }
 
 /**
@@ -1127,6 +2777,16 @@ void UNDIMediaSender::Shutdown()
 
 		// Remove the handler for the send audio frame
 		FNDIConnectionService::EventOnSendAudioFrame.RemoveAll(this);
+
+		// Audio sent from the CPU only overrides the submix for as long as the sender is active
+		bIsSendingAudioFromCPU = false;
+
+		// Stop listening to the routed submix
+		if (ListenedAudioSubmix != nullptr)
+		{
+			FNDIConnectionService::RemoveSubmixListener(ListenedAudioSubmix);
+			ListenedAudioSubmix = nullptr;
+		}
 	}
 
 	// Perform cleanup on the renderer related materials
@@ -1141,17 +2801,52 @@ void UNDIMediaSender::Shutdown()
 
 			// send an empty frame over NDI to be able to cleanup the buffers
 			this->ReadbackTextures.Flush(RHICmdList, p_send_instance);
+			this->CPUVideoFrames.Flush(p_send_instance);
 
 			NDIlib_send_destroy(p_send_instance);
 			p_send_instance = nullptr;
 		}
 
+		// destroy the proxy sender
+		if (p_proxy_send_instance != nullptr)
+		{
+			// Get the command list interface
+			FRHICommandListImmediate& RHICmdList = FRHICommandListExecutor::GetImmediateCommandList();
+
+			// send an empty frame over NDI to be able to cleanup the buffers
+			this->ProxyReadbackTextures.Flush(RHICmdList, p_proxy_send_instance);
+
+			NDIlib_send_destroy(p_proxy_send_instance);
+			p_proxy_send_instance = nullptr;
+		}
+
+		// destroy the senders of the output regions, on the render thread where their textures are unmapped
+		DestroyRegionSenders();
+		RegionReleaseFence.BeginFence();
+
 		this->DefaultVideoTextureRHI.SafeRelease();
+		this->InputTextureRHI.SafeRelease();
 
 		this->ReadbackTextures.Destroy();
+		this->ProxyReadbackTextures.Destroy();
+		for (FFingerprintReadback& Readback : this->FingerprintReadbacks)
+		{
+			Readback.Texture.Destroy();
+			Readback.bIsPending = false;
+		}
+		this->CPUVideoFrames.Destroy();
 
 		this->RenderTargetDescriptor.Reset();
+		this->ProxyRenderTargetDescriptor.Reset();
+
+		ResetFramePacing();
+		this->FingerprintRenderTargetDescriptor.Reset();
+		this->LastFingerprint.Reset();
 	}
+
+	// The pacing worker takes the render sync context, so it is stopped once that has been released; it has
+	// nothing left to send by now
+	StopPacingThread();
 }
 
 /**
@@ -1167,12 +2862,26 @@ void UNDIMediaSender::BeginDestroy()
 	Super::BeginDestroy();
 }
 
+/**
+	Called to check whether the object is ready to be destroyed, once the render commands releasing the streams
+	of the output regions have run
+*/
+bool UNDIMediaSender::IsReadyForFinishDestroy()
+{
+	return Super::IsReadyForFinishDestroy() && RegionReleaseFence.IsFenceComplete();
+}
+
 /**
 	Set whether or not a Linear to sRGB conversion is made
 */
 void UNDIMediaSender::PerformLinearTosRGBConversion(bool Value)
 {
+	FScopeLock RenderLock(&RenderSyncContext);
+
 	this->bPerformLinearTosRGB = Value;
+
+	// The converted frames change even if the input does not
+	this->LastFingerprint.Reset();
 }
 
 /**
@@ -1207,6 +2916,52 @@ FTextureResource* UNDIMediaSender::GetRenderTargetResource() const
 	return nullptr;
 }
 
+/**
+	Returns the texture to convert and send: the RHI input texture, else the Input Texture, else the Render Target
+*/
+FTexture2DRHIRef UNDIMediaSender::GetInputTextureRHI() const
+{
+	FRHITexture* Texture = nullptr;
+
+	if (this->InputTextureRHI.IsValid())
+	{
+		Texture = this->InputTextureRHI;
+	}
+	else if (IsValid(this->InputTexture))
+	{
+#if ENGINE_MAJOR_VERSION >= 5
+		FTextureResource* Resource = this->InputTexture->GetResource();
+#elif ENGINE_MAJOR_VERSION == 4
+		FTextureResource* Resource = this->InputTexture->Resource;
+#else
+		#error "Unsupported engine major version"
+#endif
+		if (Resource != nullptr)
+			Texture = Resource->TextureRHI;
+	}
+	else if (GetRenderTargetResource() != nullptr)
+	{
+		Texture = GetRenderTargetResource()->TextureRHI;
+	}
+
+	if (Texture == nullptr)
+		return nullptr;
+
+	// Media textures may be texture references, convert from the texture they reference
+	if (FRHITextureReference* TextureReference = Texture->GetTextureReference())
+	{
+		Texture = TextureReference->GetReferencedTexture();
+		if (Texture == nullptr)
+			return nullptr;
+	}
+
+#if (ENGINE_MAJOR_VERSION > 5) || ((ENGINE_MAJOR_VERSION == 5) && (ENGINE_MINOR_VERSION >= 1))
+	return Texture;
+#else
+	return Texture->GetTexture2D();
+#endif
+}
+
 
 
 /**
@@ -1226,7 +2981,7 @@ UNDIMediaSender::MappedTexture::~MappedTexture()
 	Create the readback texture. If the texture was already created it will first be destroyed.
 	The MappedTexture must currently not be mapped.
 */
-void UNDIMediaSender::MappedTexture::Create(FIntPoint InFrameSize)
+void UNDIMediaSender::MappedTexture::Create(FIntPoint InFrameSize, EPixelFormat InPixelFormat)
 {
 	Destroy();
 
@@ -1236,7 +2991,7 @@ void UNDIMediaSender::MappedTexture::Create(FIntPoint InFrameSize)
 #if (ENGINE_MAJOR_VERSION > 5) || ((ENGINE_MAJOR_VERSION == 5) && (ENGINE_MINOR_VERSION >= 1))
 	const FRHITextureCreateDesc CreateDesc = FRHITextureCreateDesc::Create2D(TEXT("NDIMediaSenderMappedTexture"))
 		.SetExtent(InFrameSize.X, InFrameSize.Y)
-		.SetFormat(PF_B8G8R8A8)
+		.SetFormat(InPixelFormat)
 		.SetNumMips(1)
 		.SetFlags(ETextureCreateFlags::CPUReadback);
 	Texture = RHICreateTexture(CreateDesc);
@@ -1245,13 +3000,13 @@ void UNDIMediaSender::MappedTexture::Create(FIntPoint InFrameSize)
 	FRHIResourceCreateInfo CreateInfo(TEXT("NDIMediaSenderMappedTexture"));
 
 	// Recreate the read back texture
-	Texture = RHICreateTexture2D(InFrameSize.X, InFrameSize.Y, PF_B8G8R8A8, 1, 1, TexCreate_CPUReadback, CreateInfo);
+	Texture = RHICreateTexture2D(InFrameSize.X, InFrameSize.Y, InPixelFormat, 1, 1, TexCreate_CPUReadback, CreateInfo);
 #elif ENGINE_MAJOR_VERSION == 4
 	// Resource creation structure
 	FRHIResourceCreateInfo CreateInfo(TEXT("NDIMediaSenderMappedTexture"));
 
 	// Recreate the read back texture
-	Texture = RHICreateTexture2D(InFrameSize.X, InFrameSize.Y, PF_B8G8R8A8, 1, 1, TexCreate_CPUReadback, CreateInfo);
+	Texture = RHICreateTexture2D(InFrameSize.X, InFrameSize.Y, InPixelFormat, 1, 1, TexCreate_CPUReadback, CreateInfo);
 #else
 	#error "Unsupported engine major version"
 #endif
@@ -1336,6 +3091,14 @@ void* UNDIMediaSender::MappedTexture::MappedData() const
 	return pData;
 }
 
+/**
+	Return whether the readback texture is currently mapped.
+*/
+bool UNDIMediaSender::MappedTexture::IsMapped() const
+{
+	return pData != nullptr;
+}
+
 /**
 	Unmap the readback texture (if currently mapped).
 */
@@ -1349,7 +3112,7 @@ void UNDIMediaSender::MappedTexture::Unmap(FRHICommandListImmediate& RHICmdList)
 		pData = nullptr;
 	}
 
-	MetaData.clear();
+	MetaData.Reset();
 
 	check(pData == nullptr);
 }
@@ -1358,20 +3121,28 @@ void UNDIMediaSender::MappedTexture::Unmap(FRHICommandListImmediate& RHICmdList)
 /**
 	Adds metadata to the texture
 */
-void UNDIMediaSender::MappedTexture::AddMetaData(const FString& Data)
+void UNDIMediaSender::MappedTexture::AddMetaData(const FNDIMetadataBuilder& Data)
 {
-	std::string DataStr(TCHAR_TO_UTF8(*Data));
-	MetaData += DataStr;
+	MetaData.Append(Data);
 }
 
 /**
 	Gets the metadata for the texture
 */
-const std::string& UNDIMediaSender::MappedTexture::GetMetaData() const
+const FNDIMetadataBuilder& UNDIMediaSender::MappedTexture::GetMetaData() const
 {
 	return MetaData;
 }
 
+/**
+	Moves the metadata out of the texture, leaving it without metadata
+*/
+void UNDIMediaSender::MappedTexture::MoveMetaData(FNDIMetadataBuilder& OutMetaData)
+{
+	OutMetaData.Swap(MetaData);
+	MetaData.Reset();
+}
+
 
 /**
 	Class for managing the sending of mapped texture data to an NDI video stream.
@@ -1385,15 +3156,15 @@ const std::string& UNDIMediaSender::MappedTexture::GetMetaData() const
 	Create the mapped texture sender. If the mapped texture sender was already created
 	it will first be destroyed. No texture must currently be mapped.
 */
-void UNDIMediaSender::MappedTextureASyncSender::Create(FIntPoint InFrameSize)
+void UNDIMediaSender::MappedTextureASyncSender::Create(FIntPoint InFrameSize, EPixelFormat InPixelFormat)
 {
 	Destroy();
 
 	MappedTexture& CurrentMappedTexture = MappedTextures[CurrentIndex];
-	CurrentMappedTexture.Create(InFrameSize);
+	CurrentMappedTexture.Create(InFrameSize, InPixelFormat);
 
 	MappedTexture& PreviousMappedTexture = MappedTextures[1-CurrentIndex];
-	PreviousMappedTexture.Create(InFrameSize);
+	PreviousMappedTexture.Create(InFrameSize, InPixelFormat);
 }
 
 /**
@@ -1453,9 +3224,9 @@ void UNDIMediaSender::MappedTextureASyncSender::Send(FRHICommandListImmediate& R
 	p_video_data.p_data = (uint8_t*)CurrentMappedTexture.MappedData();
 
 	auto& MetaData = CurrentMappedTexture.GetMetaData();
-	if(MetaData.empty() == false)
+	if(MetaData.IsEmpty() == false)
 	{
-		p_video_data.p_metadata = MetaData.c_str();
+		p_video_data.p_metadata = MetaData.GetData();
 	}
 	else
 	{
@@ -1473,6 +3244,26 @@ void UNDIMediaSender::MappedTextureASyncSender::Send(FRHICommandListImmediate& R
 	CurrentIndex = 1 - CurrentIndex;
 }
 
+/**
+	Sends the previously sent texture of the mapped texture sender to an NDI video stream again, without swapping
+	the textures. Returns false if there is no previously sent texture still mapped.
+*/
+bool UNDIMediaSender::MappedTextureASyncSender::Resend(NDIlib_send_instance_t p_send_instance_in, NDIlib_video_frame_v2_t& p_video_data)
+{
+	check(p_send_instance_in != nullptr);
+
+	// The previous texture stays mapped until the next frame is sent, so it can be sent again in between
+	MappedTexture& PreviousMappedTexture = MappedTextures[1-CurrentIndex];
+	if (PreviousMappedTexture.IsMapped() == false)
+		return false;
+
+	p_video_data.p_data = (uint8_t*)PreviousMappedTexture.MappedData();
+
+	NDIlib_send_send_video_async_v2(p_send_instance_in, &p_video_data);
+
+	return true;
+}
+
 /**
 	Flushes the NDI video stream, and unmaps the textures (if mapped)
 */
@@ -1500,8 +3291,121 @@ void UNDIMediaSender::MappedTextureASyncSender::Flush(FRHICommandListImmediate&
 /**
 	Adds metadata to the current texture
 */
-void UNDIMediaSender::MappedTextureASyncSender::AddMetaData(const FString& Data)
+void UNDIMediaSender::MappedTextureASyncSender::AddMetaData(const FNDIMetadataBuilder& Data)
 {
 	MappedTexture& CurrentMappedTexture = MappedTextures[CurrentIndex];
 	CurrentMappedTexture.AddMetaData(Data);
 }
+
+/**
+	Moves the metadata out of the current texture, to send it with a frame converted on the CPU
+*/
+void UNDIMediaSender::MappedTextureASyncSender::MoveMetaData(FNDIMetadataBuilder& OutMetaData)
+{
+	MappedTexture& CurrentMappedTexture = MappedTextures[CurrentIndex];
+	CurrentMappedTexture.MoveMetaData(OutMetaData);
+}
+
+/**
+	Returns whether metadata is waiting to be sent with the current texture
+*/
+bool UNDIMediaSender::MappedTextureASyncSender::HasMetaData() const
+{
+	const MappedTexture& CurrentMappedTexture = MappedTextures[CurrentIndex];
+	return CurrentMappedTexture.GetMetaData().IsEmpty() == false;
+}
+
+/**
+	Return a pointer to the content of the current texture, for streams sharing it to send parts of it.
+	The current texture must currently be mapped.
+*/
+const uint8* UNDIMediaSender::MappedTextureASyncSender::GetMappedData() const
+{
+	const MappedTexture& CurrentMappedTexture = MappedTextures[CurrentIndex];
+	return (const uint8*)CurrentMappedTexture.MappedData();
+}
+
+/**
+	Swaps the textures, once the current texture has been sent on every stream sharing it. Sending it guarantees
+	the frames sent before have been processed, so the texture for the previous frame is unmapped.
+*/
+void UNDIMediaSender::MappedTextureASyncSender::Advance(FRHICommandListImmediate& RHICmdList)
+{
+	MappedTexture& PreviousMappedTexture = MappedTextures[1-CurrentIndex];
+	PreviousMappedTexture.Unmap(RHICmdList);
+
+	// Switch the current and previous textures
+	CurrentIndex = 1 - CurrentIndex;
+}
+
+/**
+	Unmaps the textures (if mapped). Every stream they were sent on must have been flushed.
+*/
+void UNDIMediaSender::MappedTextureASyncSender::Unmap(FRHICommandListImmediate& RHICmdList)
+{
+	MappedTextures[0].Unmap(RHICmdList);
+	MappedTextures[1].Unmap(RHICmdList);
+}
+
+
+/**
+	Class for managing the asynchronous sending of video frames converted on the CPU. The buffer passed to
+	send_video_async must remain valid until the next frame has been sent, so two buffers are used in turn.
+*/
+
+/**
+	Returns the current buffer, sized to hold at least SizeInBytes
+*/
+uint8* UNDIMediaSender::CPUFrameASyncSender::GetBuffer(int32 SizeInBytes)
+{
+	TArray<uint8>& CurrentBuffer = Buffers[CurrentIndex];
+	CurrentBuffer.SetNumUninitialized(SizeInBytes, false);
+	return CurrentBuffer.GetData();
+}
+
+/**
+	Returns the metadata to send with the current buffer
+*/
+FNDIMetadataBuilder& UNDIMediaSender::CPUFrameASyncSender::GetMetaData()
+{
+	return MetaData[CurrentIndex];
+}
+
+/**
+	Send the current buffer to an NDI video stream, then swaps the buffers
+*/
+void UNDIMediaSender::CPUFrameASyncSender::Send(NDIlib_send_instance_t p_send_instance_in, NDIlib_video_frame_v2_t& p_video_data)
+{
+	check(p_send_instance_in != nullptr);
+
+	const FNDIMetadataBuilder& CurrentMetaData = MetaData[CurrentIndex];
+	p_video_data.p_metadata = CurrentMetaData.IsEmpty() ? nullptr : CurrentMetaData.GetData();
+
+	NDIlib_send_send_video_async_v2(p_send_instance_in, &p_video_data);
+
+	// After send_video_async returns, the buffer of the frame sent before this one can be reused
+	CurrentIndex = 1 - CurrentIndex;
+	MetaData[CurrentIndex].Reset();
+}
+
+/**
+	Flushes the NDI video stream, after which both buffers can be reused
+*/
+void UNDIMediaSender::CPUFrameASyncSender::Flush(NDIlib_send_instance_t p_send_instance_in)
+{
+	check(p_send_instance_in != nullptr);
+
+	NDIlib_send_send_video_async_v2(p_send_instance_in, nullptr);
+}
+
+/**
+	Releases the buffers; the NDI video stream must have been flushed
+*/
+void UNDIMediaSender::CPUFrameASyncSender::Destroy()
+{
+	for (int32 Index = 0; Index < 2; ++Index)
+	{
+		Buffers[Index].Empty();
+		MetaData[Index].Empty();
+	}
+}
@@ -8,97 +8,26 @@
 #include <Objects/Media/NDIMediaTexture2D.h>
 #include <Objects/Media/NDIMediaTextureResource.h>
 #include <Misc/EngineVersionComparison.h>
+#include <TextureResource.h>
+#include <RenderingThread.h>
 
-UNDIMediaTexture2D::UNDIMediaTexture2D(const FObjectInitializer& ObjectInitializer) : Super(ObjectInitializer)
-{
-	this->SetMyResource(nullptr);
-}
-
-void UNDIMediaTexture2D::UpdateTextureReference(FRHICommandList& RHICmdList, FTexture2DRHIRef Reference)
+/**
+	The black texture media textures show while they have no video. A single one is shared by all of them, rather
+	than one being created for each texture, and again each time a texture is cleared.
+*/
+class FNDIMediaPlaceholderTexture : public FTexture
 {
-	if (GetMyResource() != nullptr)
-	{
-		static int32 DefaultWidth = 1280;
-		static int32 DefaultHeight = 720;
-
-		if (Reference.IsValid() && GetMyResource()->TextureRHI != Reference)
-		{
-			GetMyResource()->TextureRHI = (FTexture2DRHIRef&)Reference;
-			RHIUpdateTextureReference(TextureReference.TextureReferenceRHI, GetMyResource()->TextureRHI);
-		}
-		else if (!Reference.IsValid())
-		{
-			if (FNDIMediaTextureResource* TextureResource = static_cast<FNDIMediaTextureResource*>(this->GetMyResource()))
-			{
-				// Set the default video texture to reference nothing
-				TRefCountPtr<FRHITexture2D> RenderableTexture;
-
-#if (ENGINE_MAJOR_VERSION > 5) || ((ENGINE_MAJOR_VERSION == 5) && (ENGINE_MINOR_VERSION >= 1))
-				const FRHITextureCreateDesc CreateDesc = FRHITextureCreateDesc::Create2D(TEXT("NDIMediaTexture2DUpdateTextureReference"))
-					.SetExtent(DefaultWidth, DefaultHeight)
-					.SetFormat(EPixelFormat::PF_B8G8R8A8)
-					.SetNumMips(1)
-					.SetFlags(ETextureCreateFlags::Dynamic | ETextureCreateFlags::RenderTargetable)
-					.SetClearValue(FClearValueBinding(FLinearColor(0.0f, 0.0f, 0.0f)));
-
-				RenderableTexture = RHICreateTexture(CreateDesc);
-#elif ENGINE_MAJOR_VERSION == 5
-				TRefCountPtr<FRHITexture2D> ShaderTexture2D;
-
-				FRHIResourceCreateInfo CreateInfo = {
-					TEXT("NDIMediaTexture2DUpdateTextureReference"),
-					FClearValueBinding(FLinearColor(0.0f, 0.0f, 0.0f))
-				};
-
-				RHICreateTargetableShaderResource2D(DefaultWidth, DefaultHeight, EPixelFormat::PF_B8G8R8A8, 1,
-					TexCreate_Dynamic, TexCreate_RenderTargetable, false, CreateInfo,
-					RenderableTexture, ShaderTexture2D);
-#elif ENGINE_MAJOR_VERSION == 4
-				TRefCountPtr<FRHITexture2D> ShaderTexture2D;
-
-				FRHIResourceCreateInfo CreateInfo = { FClearValueBinding(FLinearColor(0.0f, 0.0f, 0.0f)) };
-
-				RHICreateTargetableShaderResource2D(DefaultWidth, DefaultHeight, EPixelFormat::PF_B8G8R8A8, 1,
-					TexCreate_Dynamic, TexCreate_RenderTargetable, false, CreateInfo,
-					RenderableTexture, ShaderTexture2D);
+public:
+#if (ENGINE_MAJOR_VERSION > 5) || ((ENGINE_MAJOR_VERSION == 5) && (ENGINE_MINOR_VERSION >= 3))
+	virtual void InitRHI(FRHICommandListBase& RHICmdList) override
 #else
-				#error "Unsupported engine major version"
+	virtual void InitRHI() override
 #endif
-
-				TextureResource->TextureRHI = (FTextureRHIRef&)RenderableTexture;
-
-				ENQUEUE_RENDER_COMMAND(FNDIMediaTexture2DUpdateTextureReference)
-				([this](FRHICommandListImmediate& RHICmdList) {
-					RHIUpdateTextureReference(TextureReference.TextureReferenceRHI, Resource->TextureRHI);
-				});
-
-				// Make sure _RenderThread is executed before continuing
-				FlushRenderingCommands();
-			}
-		}
-	}
-}
-
-FTextureResource* UNDIMediaTexture2D::CreateResource()
-{
-	if (this->GetMyResource() != nullptr)
 	{
-		delete this->GetMyResource();
-		this->SetMyResource(nullptr);
-	}
-
-	if (FNDIMediaTextureResource* TextureResource = new FNDIMediaTextureResource(this))
-	{
-		this->SetMyResource(TextureResource);
-
-		static int32 DefaultWidth = 1280;
-		static int32 DefaultHeight = 720;
-
-		// Set the default video texture to reference nothing
 		TRefCountPtr<FRHITexture2D> RenderableTexture;
 
 #if (ENGINE_MAJOR_VERSION > 5) || ((ENGINE_MAJOR_VERSION == 5) && (ENGINE_MINOR_VERSION >= 1))
-		const FRHITextureCreateDesc CreateDesc = FRHITextureCreateDesc::Create2D(TEXT("NDIMediaTexture2DCreateResourceTexture"))
+		const FRHITextureCreateDesc CreateDesc = FRHITextureCreateDesc::Create2D(TEXT("NDIMediaTexture2DPlaceholderTexture"))
 			.SetExtent(DefaultWidth, DefaultHeight)
 			.SetFormat(EPixelFormat::PF_B8G8R8A8)
 			.SetNumMips(1)
@@ -110,7 +39,7 @@ FTextureResource* UNDIMediaTexture2D::CreateResource()
 		TRefCountPtr<FRHITexture2D> ShaderTexture2D;
 
 		FRHIResourceCreateInfo CreateInfo = {
-			TEXT("NDIMediaTexture2DCreateResourceTexture"),
+			TEXT("NDIMediaTexture2DPlaceholderTexture"),
 			FClearValueBinding(FLinearColor(0.0f, 0.0f, 0.0f))
 		};
 
@@ -129,11 +58,80 @@ FTextureResource* UNDIMediaTexture2D::CreateResource()
 		#error "Unsupported engine major version"
 #endif
 
-		GetMyResource()->TextureRHI = (FTextureRHIRef&)RenderableTexture;
+		TextureRHI = (FTextureRHIRef&)RenderableTexture;
+	}
+
+	virtual uint32 GetSizeX() const override
+	{
+		return DefaultWidth;
+	}
+
+	virtual uint32 GetSizeY() const override
+	{
+		return DefaultHeight;
+	}
+
+private:
+	static constexpr int32 DefaultWidth = 1280;
+	static constexpr int32 DefaultHeight = 720;
+};
+
+static TGlobalResource<FNDIMediaPlaceholderTexture> GNDIMediaPlaceholderTexture;
+
+/** ************************ **/
+
+UNDIMediaTexture2D::UNDIMediaTexture2D(const FObjectInitializer& ObjectInitializer) : Super(ObjectInitializer)
+{
+	this->SetMyResource(nullptr);
+}
 
+/**
+	Points the texture at the given texture, or at the shared placeholder when none is given. The change is made on
+	the render thread, so calling this from the game thread never waits for the render thread to catch up.
+*/
+void UNDIMediaTexture2D::UpdateTextureReference(FRHICommandList& RHICmdList, FTexture2DRHIRef Reference)
+{
+	if (GetMyResource() != nullptr)
+	{
 		ENQUEUE_RENDER_COMMAND(FNDIMediaTexture2DUpdateTextureReference)
+		([this, Reference](FRHICommandListImmediate& RHICmdList) {
+			this->SetTextureReference_RenderThread(Reference.GetReference());
+		});
+	}
+}
+
+void UNDIMediaTexture2D::SetTextureReference_RenderThread(FRHITexture* Texture)
+{
+	FTextureResource* TextureResource = this->GetMyResource();
+	if (TextureResource == nullptr)
+		return;
+
+	if (Texture == nullptr)
+		Texture = GNDIMediaPlaceholderTexture.TextureRHI.GetReference();
+
+	if (TextureResource->TextureRHI.GetReference() != Texture)
+	{
+		TextureResource->TextureRHI = Texture;
+		RHIUpdateTextureReference(TextureReference.TextureReferenceRHI, Texture);
+	}
+}
+
+FTextureResource* UNDIMediaTexture2D::CreateResource()
+{
+	if (this->GetMyResource() != nullptr)
+	{
+		delete this->GetMyResource();
+		this->SetMyResource(nullptr);
+	}
+
+	if (FNDIMediaTextureResource* TextureResource = new FNDIMediaTextureResource(this))
+	{
+		this->SetMyResource(TextureResource);
+
+		// Show the shared placeholder until the first frame is received
+		ENQUEUE_RENDER_COMMAND(FNDIMediaTexture2DCreateResource)
 		([this](FRHICommandListImmediate& RHICmdList) {
-			RHIUpdateTextureReference(TextureReference.TextureReferenceRHI, Resource->TextureRHI);
+			this->SetTextureReference_RenderThread(nullptr);
 		});
 	}
 
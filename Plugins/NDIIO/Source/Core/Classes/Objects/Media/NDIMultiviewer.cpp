@@ -0,0 +1,514 @@
+/*
+	Copyright (C) 2023 Vizrt NDI AB. All rights reserved.
+
+	This file and it's use within a Product is bound by the terms of NDI SDK license that was provided
+	as part of the NDI SDK. For more information, please review the license and the NDI SDK documentation.
+*/
+
+#include <Objects/Media/NDIMultiviewer.h>
+#include <Misc/CoreDelegates.h>
+#include <TextureResource.h>
+#include <CanvasTypes.h>
+#include <Engine/Engine.h>
+#include <Engine/Font.h>
+#include <GlobalShader.h>
+#include <MediaShaders.h>
+#include <HAL/PlatformTime.h>
+
+#include "NDIShaders.h"
+
+DECLARE_GPU_STAT_NAMED(NDIMultiviewer, TEXT("NDI Multiviewer"));
+
+/**
+	Connects the sources of the tiles and starts composing them into the output target
+*/
+void UNDIMultiviewer::Initialize()
+{
+	if (!IsValid(this->OutputTarget))
+	{
+		this->OutputTarget = NewObject<UTextureRenderTarget2D>(this, NAME_None, RF_Transient);
+		this->OutputTarget->InitCustomFormat(FMath::Max(OutputSize.X, 2), FMath::Max(OutputSize.Y, 2), PF_B8G8R8A8, false);
+		this->OutputTarget->UpdateResourceImmediate(true);
+	}
+
+	if (IsValid(this->Sender))
+		this->Sender->ChangeVideoTexture(this->OutputTarget);
+
+	ChangeTiles(TArray<FNDIMultiviewerTile>(this->Tiles));
+
+	// The tiles are composed at the end of every engine render frame, like a standalone receiver is drawn
+	FCoreDelegates::OnEndFrameRT.Remove(FrameEndRTHandle);
+	FrameEndRTHandle = FCoreDelegates::OnEndFrameRT.AddLambda([this]()
+	{
+		this->RenderTiles_RenderThread(FRHICommandListExecutor::GetImmediateCommandList());
+	});
+}
+
+/**
+	Changes the tiles of the multiviewer. Sources which were already shown keep their connection. Tiles past the
+	number a single pass composes are dropped, rather than connected and never shown.
+*/
+void UNDIMultiviewer::ChangeTiles(const TArray<FNDIMultiviewerTile>& InTiles)
+{
+	if (RetiredReceiversFence.IsFenceComplete())
+		RetiredReceivers.Reset();
+
+	TArray<UNDIMediaReceiver*> OldReceivers = MoveTemp(Receivers);
+	Receivers.Reset();
+
+	TArray<FNDIMultiviewerTile> NewTiles(InTiles.GetData(), FMath::Min(InTiles.Num(), FNDIIOShaderMultiviewerPS::MaxTiles));
+
+	for (const FNDIMultiviewerTile& Tile : NewTiles)
+	{
+		int32 OldIndex = OldReceivers.IndexOfByPredicate([&](UNDIMediaReceiver* Receiver)
+		{
+			const FNDIConnectionInformation& Connection = Receiver->GetCurrentConnectionInformation();
+			return (Connection.SourceName == Tile.Source.SourceName) && (Connection.MachineName == Tile.Source.MachineName) &&
+				   (Connection.StreamName == Tile.Source.StreamName) && (Connection.Url == Tile.Source.Url);
+		});
+
+		UNDIMediaReceiver* Receiver = nullptr;
+		if (OldIndex != INDEX_NONE)
+		{
+			Receiver = OldReceivers[OldIndex];
+			OldReceivers.RemoveAt(OldIndex);
+
+			Receiver->ChangeConnection(Tile.Source);
+		}
+		else
+		{
+			// The multiviewer captures the frames of its receivers itself, rather than each of them converting its
+			// frames into a render target of its own
+			Receiver = NewObject<UNDIMediaReceiver>(this, NAME_None, RF_Transient);
+			Receiver->Initialize(Tile.Source, UNDIMediaReceiver::EUsage::Controlled);
+			Receiver->OnNDIReceiverVideoCaptureEvent.AddUObject(this, &UNDIMultiviewer::OnVideoCaptured_RenderThread);
+			Receiver->OnNDIReceiverAudioCaptureEvent.AddUObject(this, &UNDIMultiviewer::OnAudioCaptured_RenderThread);
+		}
+
+		Receivers.Add(Receiver);
+	}
+
+	this->Tiles = MoveTemp(NewTiles);
+
+	UpdateRenderTiles();
+	DrawLabels();
+
+	// The receivers no longer shown are disconnected, but only released once the render thread is done with them
+	for (UNDIMediaReceiver* Receiver : OldReceivers)
+	{
+		Receiver->OnNDIReceiverVideoCaptureEvent.RemoveAll(this);
+		Receiver->OnNDIReceiverAudioCaptureEvent.RemoveAll(this);
+		Receiver->Shutdown();
+		RetiredReceivers.Add(Receiver);
+	}
+	RetiredReceiversFence.BeginFence();
+}
+
+/**
+	Changes the tally of the tile at the given index
+*/
+void UNDIMultiviewer::ChangeTally(int32 Index, ENDITallyState InTally)
+{
+	if (this->Tiles.IsValidIndex(Index) && (this->Tiles[Index].Tally != InTally))
+	{
+		this->Tiles[Index].Tally = InTally;
+		UpdateRenderTiles();
+	}
+}
+
+/**
+	Stops composing the tiles and disconnects their sources
+*/
+void UNDIMultiviewer::Shutdown()
+{
+	FCoreDelegates::OnEndFrameRT.Remove(FrameEndRTHandle);
+	FrameEndRTHandle.Reset();
+
+	for (UNDIMediaReceiver* Receiver : Receivers)
+	{
+		if (IsValid(Receiver))
+		{
+			Receiver->OnNDIReceiverVideoCaptureEvent.RemoveAll(this);
+			Receiver->OnNDIReceiverAudioCaptureEvent.RemoveAll(this);
+			Receiver->Shutdown();
+		}
+	}
+
+	RetiredReceivers.Append(Receivers);
+	Receivers.Reset();
+
+	ENQUEUE_RENDER_COMMAND(NDIMultiviewer_ShutdownRT)([this](FRHICommandListImmediate& RHICmdList)
+	{
+		this->RenderTiles.Reset();
+		this->AtlasTexture.SafeRelease();
+		this->AtlasSlotSize = FIntPoint(0, 0);
+	});
+	RetiredReceiversFence.BeginFence();
+}
+
+/**
+	Returns the render target the tiles are composed into
+*/
+UTextureRenderTarget2D* UNDIMultiviewer::GetOutputTarget() const
+{
+	return this->OutputTarget;
+}
+
+/**
+	Returns the time, in milliseconds, the render thread spent on the last frame
+*/
+float UNDIMultiviewer::GetRenderThreadTime() const
+{
+	return this->RenderThreadTime;
+}
+
+/**
+   Called before destroying the object.  This is called immediately upon deciding to destroy the object,
+   to allow the object to begin an asynchronous cleanup process.
+ */
+void UNDIMultiviewer::BeginDestroy()
+{
+	this->Shutdown();
+
+	Super::BeginDestroy();
+}
+
+/**
+	Called to check whether the object is ready to be destroyed, once the render thread has stopped composing the
+	tiles and released them
+*/
+bool UNDIMultiviewer::IsReadyForFinishDestroy()
+{
+	return Super::IsReadyForFinishDestroy() && RetiredReceiversFence.IsFenceComplete();
+}
+
+/**
+	Draws the labels of the tiles, one row per tile, into the label target
+*/
+void UNDIMultiviewer::DrawLabels()
+{
+	int32 TileCount = FMath::Clamp(this->Tiles.Num(), 1, FNDIIOShaderMultiviewerPS::MaxTiles);
+
+	if (!IsValid(this->LabelTarget))
+		this->LabelTarget = NewObject<UTextureRenderTarget2D>(this, NAME_None, RF_Transient);
+
+	if ((this->LabelTarget->SizeX != LabelWidth) || (this->LabelTarget->SizeY != TileCount * LabelHeight))
+	{
+		this->LabelTarget->InitCustomFormat(LabelWidth, TileCount * LabelHeight, PF_B8G8R8A8, true);
+		this->LabelTarget->UpdateResourceImmediate(true);
+	}
+
+	FTextureRenderTargetResource* Resource = this->LabelTarget->GameThread_GetRenderTargetResource();
+	UFont* Font = (GEngine != nullptr) ? GEngine->GetMediumFont() : nullptr;
+	if ((Resource == nullptr) || (Font == nullptr))
+		return;
+
+	FCanvas Canvas(Resource, nullptr, nullptr, GMaxRHIFeatureLevel);
+	Canvas.Clear(FLinearColor::Transparent);
+
+	for (int32 TileIndex = 0; TileIndex < FMath::Min(this->Tiles.Num(), TileCount); ++TileIndex)
+	{
+		FString Label = this->Tiles[TileIndex].GetDisplayLabel();
+
+		int32 TextWidth = 0;
+		int32 TextHeight = 0;
+		Font->GetStringHeightAndWidth(Label, TextHeight, TextWidth);
+
+		float X = FMath::Max((LabelWidth - TextWidth) / 2.f, 0.f);
+		float Y = TileIndex * LabelHeight + FMath::Max((LabelHeight - TextHeight) / 2.f, 0.f);
+		Canvas.DrawShadowedString(X, Y, *Label, Font, FLinearColor::White);
+	}
+
+	Canvas.Flush_GameThread(true);
+}
+
+/**
+	Sends the layout and the tally colours of the tiles to the render thread
+*/
+void UNDIMultiviewer::UpdateRenderTiles()
+{
+	int32 TileCount = FMath::Min(this->Tiles.Num(), FNDIIOShaderMultiviewerPS::MaxTiles);
+	int32 GridColumns = (Columns > 0) ? Columns : FMath::Max(FMath::CeilToInt(FMath::Sqrt((float)TileCount)), 1);
+	int32 GridRows = FMath::Max((TileCount + GridColumns - 1) / GridColumns, 1);
+
+	TArray<FRenderTile> NewRenderTiles;
+	for (int32 TileIndex = 0; TileIndex < TileCount; ++TileIndex)
+	{
+		FRenderTile& RenderTile = NewRenderTiles.AddDefaulted_GetRef();
+		RenderTile.Receiver = Receivers[TileIndex];
+
+		switch (this->Tiles[TileIndex].Tally)
+		{
+			case ENDITallyState::Preview:
+				RenderTile.BorderColor = PreviewColor;
+				break;
+			case ENDITallyState::Program:
+				RenderTile.BorderColor = ProgramColor;
+				break;
+			default:
+				RenderTile.BorderColor = BorderColor;
+				break;
+		}
+	}
+
+	ENQUEUE_RENDER_COMMAND(NDIMultiviewer_UpdateTilesRT)([this, NewRenderTiles, GridColumns, GridRows](FRHICommandListImmediate& RHICmdList)
+	{
+		// Tiles which keep their receiver keep their frame and levels
+		TArray<FRenderTile> OldRenderTiles = MoveTemp(this->RenderTiles);
+		this->RenderTiles = NewRenderTiles;
+		for (FRenderTile& RenderTile : this->RenderTiles)
+		{
+			if (const FRenderTile* OldRenderTile = OldRenderTiles.FindByPredicate([&](const FRenderTile& Old) { return Old.Receiver == RenderTile.Receiver; }))
+			{
+				RenderTile.SourceSize = OldRenderTile->SourceSize;
+				RenderTile.AudioLevels = OldRenderTile->AudioLevels;
+			}
+		}
+
+		// The slots of the atlas follow the layout of the tiles, so a change of layout starts over
+		if ((this->RenderColumns != GridColumns) || (this->RenderRows != GridRows))
+		{
+			this->RenderColumns = GridColumns;
+			this->RenderRows = GridRows;
+			this->AtlasTexture.SafeRelease();
+			this->AtlasSlotSize = FIntPoint(0, 0);
+		}
+	});
+}
+
+/**
+	Captures the frames of the sources, uploading them into the atlas, then composes all the tiles in one pass
+*/
+void UNDIMultiviewer::RenderTiles_RenderThread(FRHICommandListImmediate& RHICmdList)
+{
+	uint64 StartCycles = FPlatformTime::Cycles64();
+
+	SCOPED_DRAW_EVENT(RHICmdList, NDIMultiviewer);
+	SCOPED_GPU_STAT(RHICmdList, NDIMultiviewer);
+
+	UploadedFrames_RenderThread = 0;
+
+	for (FRenderTile& RenderTile : RenderTiles)
+	{
+		RenderTile.AudioPeaks = FVector2D(0, 0);
+
+		if (RenderTile.Receiver != nullptr)
+		{
+			RenderTile.Receiver->CaptureConnectedAudio();
+			RenderTile.Receiver->CaptureConnectedVideo();
+		}
+
+		// The meters fall back slowly, and show levels from -60 dBFS to 0 dBFS
+		for (int32 Channel = 0; Channel < 2; ++Channel)
+		{
+			float Peak = RenderTile.AudioPeaks[Channel];
+			float Level = (Peak > 0.001f) ? FMath::Clamp((20.f * FMath::LogX(10.f, Peak) + 60.f) / 60.f, 0.f, 1.f) : 0.f;
+			RenderTile.AudioLevels[Channel] = FMath::Max(Level, RenderTile.AudioLevels[Channel] - 0.02f);
+		}
+	}
+
+	FTextureResource* OutputResource = GetOutputTargetResource();
+	FTextureResource* LabelResource = GetLabelTargetResource();
+
+	if ((OutputResource != nullptr) && OutputResource->TextureRHI.IsValid() &&
+		(LabelResource != nullptr) && LabelResource->TextureRHI.IsValid())
+	{
+		if (!AtlasTexture.IsValid())
+		{
+			// An atlas of a single texel until the first frame arrives, so that the pass always has a texture
+#if (ENGINE_MAJOR_VERSION > 5) || ((ENGINE_MAJOR_VERSION == 5) && (ENGINE_MINOR_VERSION >= 1))
+			const FRHITextureCreateDesc CreateDesc = FRHITextureCreateDesc::Create2D(TEXT("NDIMultiviewerAtlasTexture"))
+				.SetExtent(1, 1)
+				.SetFormat(PF_B8G8R8A8)
+				.SetNumMips(1)
+				.SetFlags(ETextureCreateFlags::ShaderResource | ETextureCreateFlags::Dynamic);
+
+			AtlasTexture = RHICreateTexture(CreateDesc);
+#elif (ENGINE_MAJOR_VERSION == 4) || (ENGINE_MAJOR_VERSION == 5)
+			FRHIResourceCreateInfo CreateInfo(TEXT("NDIMultiviewerAtlasTexture"));
+			AtlasTexture = RHICreateTexture2D(1, 1, PF_B8G8R8A8, 1, 1, TexCreate_ShaderResource | TexCreate_Dynamic, CreateInfo);
+#else
+			#error "Unsupported engine major version"
+#endif
+		}
+
+		FTexture2DRHIRef OutputTexture = OutputResource->TextureRHI->GetTexture2D();
+		FIntPoint FrameSize(OutputTexture->GetSizeX(), OutputTexture->GetSizeY());
+
+		FNDIIOShaderMultiviewerPS::Params Params;
+		Params.AtlasTarget = AtlasTexture;
+		Params.LabelTarget = LabelResource->TextureRHI->GetTexture2D();
+		Params.OutputSize = FrameSize;
+		Params.Columns = RenderColumns;
+		Params.Rows = RenderRows;
+		Params.LabelSize = FIntPoint(LabelWidth, LabelHeight);
+		Params.BorderWidth = BorderWidth;
+		Params.MeterWidth = AudioMeterWidth;
+		Params.bPerformsRGBtoLinear = true;
+
+		for (int32 TileIndex = 0; TileIndex < RenderTiles.Num(); ++TileIndex)
+		{
+			const FRenderTile& RenderTile = RenderTiles[TileIndex];
+
+			FNDIIOShaderMultiviewerPS::Tile& TileParams = Params.Tiles.AddDefaulted_GetRef();
+			TileParams.AtlasOffset = FIntPoint((TileIndex % RenderColumns) * (AtlasSlotSize.X / 2), (TileIndex / RenderColumns) * AtlasSlotSize.Y);
+			TileParams.SourceSize = RenderTile.SourceSize;
+			TileParams.BorderColor = RenderTile.BorderColor;
+			TileParams.AudioLevels = RenderTile.AudioLevels;
+		}
+
+		FGraphicsPipelineStateInitializer GraphicsPSOInit;
+		FRHIRenderPassInfo RPInfo(OutputTexture, ERenderTargetActions::DontLoad_Store);
+
+		FGlobalShaderMap* ShaderMap = GetGlobalShaderMap(GMaxRHIFeatureLevel);
+		TShaderMapRef<FNDIIOShaderVS> VertexShader(ShaderMap);
+		TShaderMapRef<FNDIIOShaderMultiviewerPS> MultiviewerShader(ShaderMap);
+
+#if ENGINE_MAJOR_VERSION == 5
+		FBufferRHIRef VertexBuffer = CreateTempMediaVertexBuffer();
+#elif ENGINE_MAJOR_VERSION == 4
+		FVertexBufferRHIRef VertexBuffer = CreateTempMediaVertexBuffer();
+#else
+		#error "Unsupported engine major version"
+#endif
+
+		RHICmdList.BeginRenderPass(RPInfo, TEXT("NDI Multiviewer"));
+		RHICmdList.ApplyCachedRenderTargets(GraphicsPSOInit);
+
+		GraphicsPSOInit.DepthStencilState = TStaticDepthStencilState<false, CF_Always>::GetRHI();
+		GraphicsPSOInit.RasterizerState = TStaticRasterizerState<>::GetRHI();
+		GraphicsPSOInit.BlendState = TStaticBlendStateWriteMask<CW_RGBA, CW_NONE, CW_NONE, CW_NONE, CW_NONE, CW_NONE,
+																CW_NONE, CW_NONE>::GetRHI();
+		GraphicsPSOInit.BoundShaderState.VertexDeclarationRHI = GMediaVertexDeclaration.VertexDeclarationRHI;
+		GraphicsPSOInit.BoundShaderState.VertexShaderRHI = VertexShader.GetVertexShader();
+		GraphicsPSOInit.BoundShaderState.PixelShaderRHI = MultiviewerShader.GetPixelShader();
+		GraphicsPSOInit.PrimitiveType = PT_TriangleStrip;
+
+#if ENGINE_MAJOR_VERSION == 5
+		SetGraphicsPipelineState(RHICmdList, GraphicsPSOInit, 0);
+#elif ENGINE_MAJOR_VERSION == 4
+		SetGraphicsPipelineState(RHICmdList, GraphicsPSOInit);
+#else
+		#error "Unsupported engine major version"
+#endif
+		RHICmdList.SetStreamSource(0, VertexBuffer, 0);
+
+		MultiviewerShader->SetParameters(RHICmdList, Params);
+
+		// A single draw for all the tiles
+		RHICmdList.SetViewport(0, 0, 0.0f, FrameSize.X, FrameSize.Y, 1.0f);
+		RHICmdList.DrawPrimitive(0, 2, 1);
+
+		RHICmdList.EndRenderPass();
+	}
+
+	this->UploadedFrames = UploadedFrames_RenderThread;
+	this->RenderThreadTime = (float)((FPlatformTime::Cycles64() - StartCycles) * FPlatformTime::GetSecondsPerCycle64() * 1000.0);
+}
+
+/**
+	Uploads the frame of a tile into its slot of the atlas. The alpha of UYVA frames is not shown.
+*/
+void UNDIMultiviewer::OnVideoCaptured_RenderThread(UNDIMediaReceiver* Receiver, const NDIlib_video_frame_v2_t& video_frame)
+{
+	int32 TileIndex = RenderTiles.IndexOfByPredicate([&](const FRenderTile& RenderTile) { return RenderTile.Receiver == Receiver; });
+	if (TileIndex == INDEX_NONE)
+		return;
+
+	if ((video_frame.FourCC != NDIlib_FourCC_video_type_UYVY) && (video_frame.FourCC != NDIlib_FourCC_video_type_UYVA))
+		return;
+
+	FIntPoint FrameSize(video_frame.xres & ~1, video_frame.yres);
+	if ((FrameSize.X <= 0) || (FrameSize.Y <= 0))
+		return;
+
+	// Grow the slots to fit the largest source, which starts the atlas over
+	if (!AtlasTexture.IsValid() || (FrameSize.X > AtlasSlotSize.X) || (FrameSize.Y > AtlasSlotSize.Y))
+	{
+		AtlasSlotSize.X = FMath::Max(AtlasSlotSize.X, Align(FrameSize.X, 64));
+		AtlasSlotSize.Y = FMath::Max(AtlasSlotSize.Y, Align(FrameSize.Y, 64));
+
+		FIntPoint AtlasSize(AtlasSlotSize.X / 2 * RenderColumns, AtlasSlotSize.Y * RenderRows);
+
+#if (ENGINE_MAJOR_VERSION > 5) || ((ENGINE_MAJOR_VERSION == 5) && (ENGINE_MINOR_VERSION >= 1))
+		const FRHITextureCreateDesc CreateDesc = FRHITextureCreateDesc::Create2D(TEXT("NDIMultiviewerAtlasTexture"))
+			.SetExtent(AtlasSize.X, AtlasSize.Y)
+			.SetFormat(PF_B8G8R8A8)
+			.SetNumMips(1)
+			.SetFlags(ETextureCreateFlags::ShaderResource | ETextureCreateFlags::Dynamic);
+
+		AtlasTexture = RHICreateTexture(CreateDesc);
+#elif (ENGINE_MAJOR_VERSION == 4) || (ENGINE_MAJOR_VERSION == 5)
+		FRHIResourceCreateInfo CreateInfo(TEXT("NDIMultiviewerAtlasTexture"));
+		AtlasTexture = RHICreateTexture2D(AtlasSize.X, AtlasSize.Y, PF_B8G8R8A8, 1, 1, TexCreate_ShaderResource | TexCreate_Dynamic, CreateInfo);
+#else
+		#error "Unsupported engine major version"
+#endif
+
+		for (FRenderTile& RenderTile : RenderTiles)
+		{
+			RenderTile.SourceSize = FIntPoint(0, 0);
+		}
+	}
+
+	// The UYVY pixels are uploaded as they are, two pixels per texel, and converted when the tiles are composed
+	FIntPoint SlotOffset((TileIndex % RenderColumns) * (AtlasSlotSize.X / 2), (TileIndex / RenderColumns) * AtlasSlotSize.Y);
+	FUpdateTextureRegion2D Region(SlotOffset.X, SlotOffset.Y, 0, 0, FrameSize.X / 2, FrameSize.Y);
+	RHIUpdateTexture2D(AtlasTexture, 0, Region, video_frame.line_stride_in_bytes, (uint8*&)video_frame.p_data);
+
+	RenderTiles[TileIndex].SourceSize = FrameSize;
+	++UploadedFrames_RenderThread;
+}
+
+/**
+	Measures the peak levels of the first two channels of the audio of a tile, a mono source showing on both meters
+*/
+void UNDIMultiviewer::OnAudioCaptured_RenderThread(UNDIMediaReceiver* Receiver, const NDIlib_audio_frame_v2_t& audio_frame)
+{
+	FRenderTile* RenderTile = RenderTiles.FindByPredicate([&](const FRenderTile& Tile) { return Tile.Receiver == Receiver; });
+	if ((RenderTile == nullptr) || (audio_frame.no_channels <= 0))
+		return;
+
+	for (int32 Channel = 0; Channel < 2; ++Channel)
+	{
+		int32 SourceChannel = FMath::Min(Channel, audio_frame.no_channels - 1);
+		const float* ChannelData = reinterpret_cast<const float*>(reinterpret_cast<const uint8*>(audio_frame.p_data) + SourceChannel * audio_frame.channel_stride_in_bytes);
+
+		float Peak = RenderTile->AudioPeaks[Channel];
+		for (int32 SampleIndex = 0; SampleIndex < audio_frame.no_samples; ++SampleIndex)
+		{
+			Peak = FMath::Max(Peak, FMath::Abs(ChannelData[SampleIndex]));
+		}
+		RenderTile->AudioPeaks[Channel] = Peak;
+	}
+}
+
+FTextureResource* UNDIMultiviewer::GetOutputTargetResource() const
+{
+	if(IsValid(this->OutputTarget))
+#if ENGINE_MAJOR_VERSION == 5
+		return this->OutputTarget->GetResource();
+#elif ENGINE_MAJOR_VERSION == 4
+		return this->OutputTarget->Resource;
+#else
+		#error "Unsupported engine major version"
+		return nullptr;
+#endif
+
+	return nullptr;
+}
+
+FTextureResource* UNDIMultiviewer::GetLabelTargetResource() const
+{
+	if(IsValid(this->LabelTarget))
+#if ENGINE_MAJOR_VERSION == 5
+		return this->LabelTarget->GetResource();
+#elif ENGINE_MAJOR_VERSION == 4
+		return this->LabelTarget->Resource;
+#else
+		#error "Unsupported engine major version"
+		return nullptr;
+#endif
+
+	return nullptr;
+}
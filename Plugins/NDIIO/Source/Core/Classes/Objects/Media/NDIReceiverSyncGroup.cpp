@@ -0,0 +1,224 @@
+/*
+	Copyright (C) 2023 Vizrt NDI AB. All rights reserved.
+
+	This file and it's use within a Product is bound by the terms of NDI SDK license that was provided
+	as part of the NDI SDK. For more information, please review the license and the NDI SDK documentation.
+*/
+
+#include <Objects/Media/NDIReceiverSyncGroup.h>
+#include <Misc/CoreDelegates.h>
+#include <RenderingThread.h>
+
+/**
+	Connects the sources of the members and starts matching their frames
+*/
+void UNDIReceiverSyncGroup::Initialize()
+{
+	if (RetiredReceiversFence.IsFenceComplete())
+		RetiredReceivers.Reset();
+
+	this->Shutdown();
+
+	TArray<FRenderMember> NewRenderMembers;
+	for (const FNDIConnectionInformation& Source : this->Sources)
+	{
+		// The group captures the frames of its receivers itself, so that it decides when each of them is displayed
+		UNDIMediaReceiver* Receiver = NewObject<UNDIMediaReceiver>(this, NAME_None, RF_Transient);
+		Receiver->Initialize(Source, UNDIMediaReceiver::EUsage::Controlled);
+		Receiver->OnNDIReceiverVideoFrameEvent.AddUObject(this, &UNDIReceiverSyncGroup::OnVideoFrame_RenderThread);
+		Receivers.Add(Receiver);
+
+		FRenderMember& Member = NewRenderMembers.AddDefaulted_GetRef();
+		Member.Receiver = Receiver;
+	}
+
+	const int64 NewTolerance = (int64)(FMath::Max(this->Tolerance, 0.f) * 1e+4);
+	const int32 NewMaxBufferedFrames = FMath::Max(this->MaxBufferedFrames, 1);
+	const bool bNewMatchTimecodes = this->bMatchTimecodes;
+
+	ENQUEUE_RENDER_COMMAND(NDIReceiverSyncGroup_InitializeRT)([this, NewRenderMembers = MoveTemp(NewRenderMembers), NewTolerance,
+	                                                           NewMaxBufferedFrames, bNewMatchTimecodes](FRHICommandListImmediate& RHICmdList) mutable
+	{
+		this->RenderMembers = MoveTemp(NewRenderMembers);
+		this->RenderTolerance = NewTolerance;
+		this->RenderMaxBufferedFrames = NewMaxBufferedFrames;
+		this->bRenderMatchTimecodes = bNewMatchTimecodes;
+		this->PerformanceData.Reset();
+	});
+
+	// The frames are matched at the end of every engine render frame, like a standalone receiver is drawn
+	FrameEndRTHandle = FCoreDelegates::OnEndFrameRT.AddLambda([this]()
+	{
+		this->MatchFrames_RenderThread();
+	});
+}
+
+/**
+	Stops matching the frames and disconnects the sources of the members
+*/
+void UNDIReceiverSyncGroup::Shutdown()
+{
+	FCoreDelegates::OnEndFrameRT.Remove(FrameEndRTHandle);
+	FrameEndRTHandle.Reset();
+
+	for (UNDIMediaReceiver* Receiver : Receivers)
+	{
+		if (IsValid(Receiver))
+		{
+			Receiver->OnNDIReceiverVideoFrameEvent.RemoveAll(this);
+			Receiver->Shutdown();
+		}
+	}
+
+	RetiredReceivers.Append(Receivers);
+	Receivers.Reset();
+
+	// The buffered frames keep their connections alive, so they are released on the render thread once it is done
+	// with them, rather than with the receivers
+	ENQUEUE_RENDER_COMMAND(NDIReceiverSyncGroup_ShutdownRT)([this](FRHICommandListImmediate& RHICmdList)
+	{
+		this->RenderMembers.Reset();
+		this->PerformanceData.BufferedFrames = 0;
+	});
+	RetiredReceiversFence.BeginFence();
+}
+
+const TArray<UNDIMediaReceiver*>& UNDIReceiverSyncGroup::GetReceivers() const
+{
+	return Receivers;
+}
+
+const FNDIReceiverSyncGroupPerformanceData& UNDIReceiverSyncGroup::GetPerformanceData() const
+{
+	return PerformanceData;
+}
+
+/**
+	Called before destroying the object.  This is called immediately upon deciding to destroy the object,
+	to allow the object to begin an asynchronous cleanup process.
+*/
+void UNDIReceiverSyncGroup::BeginDestroy()
+{
+	this->Shutdown();
+
+	Super::BeginDestroy();
+}
+
+/**
+	Called to check whether the object is ready to be destroyed, once the render thread has stopped matching the
+	frames of the members and released them
+*/
+bool UNDIReceiverSyncGroup::IsReadyForFinishDestroy()
+{
+	return Super::IsReadyForFinishDestroy() && RetiredReceiversFence.IsFenceComplete();
+}
+
+/**
+	Captures the frames of the members, then releases every set of frames which can be matched. A member which stops
+	sending holds back the whole group, until it sends again, and the frames of the others meanwhile are dropped as
+	their buffers fill up.
+*/
+void UNDIReceiverSyncGroup::MatchFrames_RenderThread()
+{
+	// Capture the frames of all the members first, so that the sets are matched from every frame received
+	for (FRenderMember& Member : RenderMembers)
+	{
+		while (Member.Receiver->CaptureConnectedMetadata())
+			;
+		Member.Receiver->CaptureConnectedVideo();
+	}
+
+	TArray<FNDIVideoFrameRef> MatchedSet;
+	while (RenderMembers.Num() > 0)
+	{
+		// The latest of the first frames of the members is the earliest time a set can be matched at
+		int64 ReferenceTime = TNumericLimits<int64>::Lowest();
+		bool bHaveAllMembers = true;
+		for (const FRenderMember& Member : RenderMembers)
+		{
+			if (Member.Frames.Num() == 0)
+			{
+				bHaveAllMembers = false;
+				break;
+			}
+			ReferenceTime = FMath::Max(ReferenceTime, GetMatchTime(*Member.Frames[0]));
+		}
+
+		if (!bHaveAllMembers)
+			break;
+
+		// Frames earlier than that by more than the tolerance can never be matched anymore
+		bool bHaveDropped = false;
+		for (FRenderMember& Member : RenderMembers)
+		{
+			while ((Member.Frames.Num() > 0) && (GetMatchTime(*Member.Frames[0]) < ReferenceTime - RenderTolerance))
+			{
+				Member.Frames.RemoveAt(0);
+				++PerformanceData.DroppedFrames;
+				bHaveDropped = true;
+			}
+		}
+
+		if (bHaveDropped)
+			continue;
+
+		// Otherwise the first frames of all the members are within the tolerance, and make a set
+		int64 EarliestTime = ReferenceTime;
+		MatchedSet.Reset();
+		for (FRenderMember& Member : RenderMembers)
+		{
+			EarliestTime = FMath::Min(EarliestTime, GetMatchTime(*Member.Frames[0]));
+			MatchedSet.Add(Member.Frames[0]);
+			Member.Frames.RemoveAt(0);
+		}
+
+		++PerformanceData.MatchedSets;
+		PerformanceData.MatchSpread = (float)((ReferenceTime - EarliestTime) / 1e+4);
+
+		OnNDISyncGroupFramesEvent.Broadcast(this, MatchedSet);
+	}
+
+	// The last set matched is displayed on all the members at once; the sets before it are skipped, the way the
+	// frame sync of a standalone receiver skips the frames it has no time to display
+	if ((MatchedSet.Num() > 0) && (MatchedSet.Num() == RenderMembers.Num()))
+	{
+		for (int32 Index = 0; Index < RenderMembers.Num(); ++Index)
+			RenderMembers[Index].Receiver->PresentFrame(MatchedSet[Index]->GetFrame());
+	}
+
+	int32 BufferedFrames = 0;
+	for (const FRenderMember& Member : RenderMembers)
+		BufferedFrames += Member.Frames.Num();
+	PerformanceData.BufferedFrames = BufferedFrames;
+}
+
+/**
+	Buffers the frame of a member until a frame of every other member has arrived to match it with
+*/
+void UNDIReceiverSyncGroup::OnVideoFrame_RenderThread(UNDIMediaReceiver* Receiver, const FNDIVideoFrameRef& Frame)
+{
+	FRenderMember* Member = RenderMembers.FindByPredicate([Receiver](const FRenderMember& Candidate)
+	{
+		return Candidate.Receiver == Receiver;
+	});
+
+	if (Member == nullptr)
+		return;
+
+	Member->Frames.Add(Frame);
+
+	while (Member->Frames.Num() > RenderMaxBufferedFrames)
+	{
+		Member->Frames.RemoveAt(0);
+		++PerformanceData.DroppedFrames;
+	}
+}
+
+int64 UNDIReceiverSyncGroup::GetMatchTime(const FNDIVideoFrame& Frame) const
+{
+	// Senders which do not timestamp their frames can only be matched by timecode
+	if (bRenderMatchTimecodes || (Frame.GetTimestamp() == NDIlib_recv_timestamp_undefined))
+		return Frame.GetTimecode();
+
+	return Frame.GetTimestamp();
+}
@@ -15,6 +15,9 @@
 #include <Framework/Application/SlateApplication.h>
 #include <Misc/EngineVersionComparison.h>
 #include <Engine/Engine.h>
+#include <Sound/AudioSettings.h>
+#include <Sound/SoundSubmix.h>
+#include <NDIIOPluginAPI.h>
 
 #if WITH_EDITOR
 
@@ -27,6 +30,8 @@
 FNDIConnectionServiceSendVideoEvent FNDIConnectionService::EventOnSendVideoFrame;
 FNDIConnectionServiceSendAudioEvent FNDIConnectionService::EventOnSendAudioFrame;
 
+static FNDIConnectionService* NDI_CONNECTION_SERVICE = nullptr;
+
 /** ************************ **/
 
 /**
@@ -41,6 +46,8 @@ bool FNDIConnectionService::Start()
 	{
 		bIsInitialized = true;
 
+		NDI_CONNECTION_SERVICE = this;
+
 		// Define some basic properties
 		FNDIBroadcastConfiguration Configuration;
 		FString BroadcastName = TEXT("Unreal Engine");
@@ -53,32 +60,29 @@ bool FNDIConnectionService::Start()
 		{
 			// Define the configuration properties
 			Configuration.FrameRate = CoreSettings->BroadcastRate;
-			Configuration.FrameSize = FIntPoint(FMath::Clamp(CoreSettings->PreferredFrameSize.X, 240, 3840),
-												FMath::Clamp(CoreSettings->PreferredFrameSize.Y, 240, 3840));
+			Configuration.FrameSize = FIntPoint(FMath::Clamp(CoreSettings->PreferredFrameSize.X, 240, UNDIIOPluginSettings::MaxBroadcastFrameSize),
+												FMath::Clamp(CoreSettings->PreferredFrameSize.Y, 240, UNDIIOPluginSettings::MaxBroadcastFrameSize));
 
 			// Set the broadcast name
 			BroadcastName = CoreSettings->ApplicationStreamName;
 
 			bBeginBroadcastOnPlay = CoreSettings->bBeginBroadcastOnPlay;
 
+			// Audio and video timecodes are derived from the same clock
+			TimecodeSource = CoreSettings->TimecodeSource;
+			TimecodeFrameRate = CoreSettings->BroadcastRate;
+
 			// clean-up the settings object
 			CoreSettings->ConditionalBeginDestroy();
 			CoreSettings = nullptr;
 		}
 
-		/** Construct the Active Viewport video texture */
-		this->VideoTexture = NewObject<UTextureRenderTarget2D>(
-			GetTransientPackage(), UTextureRenderTarget2D::StaticClass(), TEXT("NDIViewportVideoTexture"), Flags);
-
 		/** Construct the active viewport sender */
 		this->ActiveViewportSender = NewObject<UNDIMediaSender>(GetTransientPackage(), UNDIMediaSender::StaticClass(),
 																TEXT("NDIViewportSender"), Flags);
 
-		VideoTexture->UpdateResource();
-
 		// Update the active viewport sender, with the properties defined in the settings configuration
 		this->ActiveViewportSender->ChangeSourceName(BroadcastName);
-		this->ActiveViewportSender->ChangeVideoTexture(VideoTexture);
 		this->ActiveViewportSender->ChangeBroadcastConfiguration(Configuration);
 
 		// Hook into the GEngine finishing initialization
@@ -122,18 +126,11 @@ void FNDIConnectionService::Shutdown()
 	// reset the initialization properties
 	bIsInitialized = false;
 
-	if (bIsAudioInitialized)
-	{
-		if (GEngine)
-		{
-			FAudioDeviceHandle AudioDevice = GEngine->GetMainAudioDevice();
-			if (AudioDevice)
-			{
-				AudioDevice->UnregisterSubmixBufferListener(this);
-			}
-		}
-		bIsAudioInitialized = false;
-	}
+	UnregisterSubmixListeners();
+	SubmixListenerCounts.Empty();
+
+	if (NDI_CONNECTION_SERVICE == this)
+		NDI_CONNECTION_SERVICE = nullptr;
 
 	// unbind our handlers for our frame events
 	FCoreDelegates::OnEndFrame.RemoveAll(this);
@@ -151,7 +148,7 @@ void FNDIConnectionService::OnEndRenderFrame()
 
 	if (bIsInitialized)
 	{
-		int64 ticks = FDateTime::Now().GetTimeOfDay().GetTicks();
+		int64 ticks = GetVideoTimecode();
 
 		if (FNDIConnectionService::EventOnSendVideoFrame.IsBound())
 		{
@@ -164,19 +161,123 @@ void FNDIConnectionService::OnFEngineLoopInitComplete()
 {
 	if (bIsInitialized)
 	{
-		if (!bIsAudioInitialized)
+		RegisterSubmixListeners();
+	}
+}
+
+/**
+	Requests audio from a submix other than the main submix to be delivered through 'EventOnSendAudioFrame'.
+	Each call must be balanced by a call to 'RemoveSubmixListener'.
+*/
+void FNDIConnectionService::AddSubmixListener(USoundSubmix* Submix)
+{
+	check(IsInGameThread());
+
+	if ((NDI_CONNECTION_SERVICE != nullptr) && IsValid(Submix))
+	{
+		int32& ListenerCount = NDI_CONNECTION_SERVICE->SubmixListenerCounts.FindOrAdd(Submix, 0);
+
+		// Only the first sender routed to a submix needs to register with the audio device,
+		// all other senders share the audio deinterleaved for the first one
+		if ((ListenerCount++ == 0) && NDI_CONNECTION_SERVICE->bIsAudioInitialized && (Submix != NDI_CONNECTION_SERVICE->MainSubmix))
 		{
 			if (GEngine)
 			{
 				FAudioDeviceHandle AudioDevice = GEngine->GetMainAudioDevice();
+				if (AudioDevice)
+				{
+					AudioDevice->RegisterSubmixBufferListener(NDI_CONNECTION_SERVICE, Submix);
+				}
+			}
+		}
+	}
+}
+
+void FNDIConnectionService::RemoveSubmixListener(USoundSubmix* Submix)
+{
+	check(IsInGameThread());
+
+	if ((NDI_CONNECTION_SERVICE != nullptr) && (Submix != nullptr))
+	{
+		int32* ListenerCount = NDI_CONNECTION_SERVICE->SubmixListenerCounts.Find(Submix);
+		if ((ListenerCount != nullptr) && (--(*ListenerCount) <= 0))
+		{
+			NDI_CONNECTION_SERVICE->SubmixListenerCounts.Remove(Submix);
+
+			if (NDI_CONNECTION_SERVICE->bIsAudioInitialized && (Submix != NDI_CONNECTION_SERVICE->MainSubmix))
+			{
+				if (GEngine)
+				{
+					FAudioDeviceHandle AudioDevice = GEngine->GetMainAudioDevice();
+					if (AudioDevice)
+					{
+						AudioDevice->UnregisterSubmixBufferListener(NDI_CONNECTION_SERVICE, Submix);
+					}
+				}
+			}
+		}
+	}
+}
+
+void FNDIConnectionService::RegisterSubmixListeners()
+{
+	if (!bIsAudioInitialized)
+	{
+		if (GEngine)
+		{
+			FAudioDeviceHandle AudioDevice = GEngine->GetMainAudioDevice();
+			if (AudioDevice)
+			{
+#if ENGINE_MAJOR_VERSION == 5
+				MainSubmix = &AudioDevice->GetMainSubmixObject();
+#elif ENGINE_MAJOR_VERSION == 4
+				MainSubmix = Cast<USoundSubmix>(GetDefault<UAudioSettings>()->MasterSubmix.TryLoad());
+#else
+				#error "Unsupported engine major version"
+#endif
+
+				// The main submix is always listened to
 				AudioDevice->RegisterSubmixBufferListener(this);
 
+				// Any other submix is only listened to while a sender is routed to it
+				for (const auto& SubmixListenerCount : SubmixListenerCounts)
+				{
+					if (SubmixListenerCount.Key != MainSubmix)
+						AudioDevice->RegisterSubmixBufferListener(this, SubmixListenerCount.Key);
+				}
+
 				bIsAudioInitialized = true;
 			}
 		}
 	}
 }
 
+void FNDIConnectionService::UnregisterSubmixListeners()
+{
+	if (bIsAudioInitialized)
+	{
+		if (GEngine)
+		{
+			FAudioDeviceHandle AudioDevice = GEngine->GetMainAudioDevice();
+			if (AudioDevice)
+			{
+				AudioDevice->UnregisterSubmixBufferListener(this);
+
+				for (const auto& SubmixListenerCount : SubmixListenerCounts)
+				{
+					if (SubmixListenerCount.Key != MainSubmix)
+						AudioDevice->UnregisterSubmixBufferListener(this, SubmixListenerCount.Key);
+				}
+			}
+		}
+		bIsAudioInitialized = false;
+	}
+
+	// Release the shared audio frames
+	FScopeLock Lock(&AudioSyncContext);
+	SubmixAudioFrames.Empty();
+}
+
 bool FNDIConnectionService::BeginBroadcastingActiveViewport()
 {
 	if (!bIsBroadcastingActiveViewport && IsValid(ActiveViewportSender))
@@ -190,19 +291,27 @@ bool FNDIConnectionService::BeginBroadcastingActiveViewport()
 
 			// Define the configuration properties
 			Configuration.FrameRate = CoreSettings->BroadcastRate;
-			Configuration.FrameSize = FIntPoint(FMath::Clamp(CoreSettings->PreferredFrameSize.X, 240, 3840),
-												FMath::Clamp(CoreSettings->PreferredFrameSize.Y, 240, 3840));
+			Configuration.FrameSize = FIntPoint(FMath::Clamp(CoreSettings->PreferredFrameSize.X, 240, UNDIIOPluginSettings::MaxBroadcastFrameSize),
+												FMath::Clamp(CoreSettings->PreferredFrameSize.Y, 240, UNDIIOPluginSettings::MaxBroadcastFrameSize));
 
 			// Set the broadcast name
 			BroadcastName = CoreSettings->ApplicationStreamName;
 
-			// clean-up the settings object
-			CoreSettings->ConditionalBeginDestroy();
-			CoreSettings = nullptr;
+			// The other windows are broadcast at their own size, under names derived from the broadcast name
+			bIsBroadcastingEveryWindow = CoreSettings->bBroadcastEveryWindow;
+			WindowStreamName = BroadcastName;
+			WindowFrameRate = CoreSettings->BroadcastRate;
 
 			// Update the active viewport sender, with the properties defined in the settings configuration
 			this->ActiveViewportSender->ChangeSourceName(BroadcastName);
 			this->ActiveViewportSender->ChangeBroadcastConfiguration(Configuration);
+
+			// Regions of the game window, such as nDisplay viewports, share the conversion of the active viewport
+			this->ActiveViewportSender->ChangeOutputRegions(CoreSettings->ViewportRegions);
+
+			// clean-up the settings object
+			CoreSettings->ConditionalBeginDestroy();
+			CoreSettings = nullptr;
 		}
 
 		// we don't want to perform the linear conversion for the active viewport,
@@ -223,6 +332,13 @@ bool FNDIConnectionService::BeginBroadcastingActiveViewport()
 			this, &FNDIConnectionService::OnActiveViewportBackbufferPreResize);
 		FSlateApplication::Get().GetRenderer()->OnBackBufferReadyToPresent().AddRaw(
 			this, &FNDIConnectionService::OnActiveViewportBackbufferReadyToPresent);
+
+		// The back buffers of destroyed windows must be released in the same way as resized ones
+		FSlateApplication::Get().GetRenderer()->OnSlateWindowDestroyed().AddRaw(
+			this, &FNDIConnectionService::OnActiveViewportBackbufferPreResize);
+
+		// The senders of the other windows follow the windows of the application
+		FCoreDelegates::OnEndFrame.AddRaw(this, &FNDIConnectionService::OnEndFrame);
 	}
 
 	// always return true
@@ -234,23 +350,23 @@ void FNDIConnectionService::OnActiveViewportBackbufferPreResize(void* Backbuffer
 {
 	check(IsInGameThread());
 
-	// Ensure we have a valid video texture
-	FTextureResource* TextureResource = GetVideoTextureResource();
-	if (TextureResource != nullptr)
+	// Ensure the senders no longer reference the back buffer
+	if (IsValid(this->ActiveViewportSender))
 	{
 		FRenderCommandFence Fence;
 
-		TextureResource->TextureRHI.SafeRelease();
-		this->ActiveViewportSender->ChangeVideoTexture(VideoTexture);
+		this->ActiveViewportSender->ChangeInputTextureRHI(nullptr);
+
+		// The back buffer may belong to any window, and the streams of the others get theirs back on their next present
+		this->ActiveViewportSender->ReleaseTextureStreamInputs();
 
-		ENQUEUE_RENDER_COMMAND(FlushRHIThreadToUpdateTextureRenderTargetReference)(
-			[this](FRHICommandListImmediate& RHICmdList)
+		ENQUEUE_RENDER_COMMAND(FlushRHIThreadToReleaseBackbufferReference)(
+			[](FRHICommandListImmediate& RHICmdList)
 			{
-				RHIUpdateTextureReference(VideoTexture->TextureReference.TextureReferenceRHI, nullptr);
 				RHICmdList.ImmediateFlush(EImmediateFlushType::FlushRHIThread);
 			});
 
-		// Wait for render thread to finish, so that renderthread texture references are updated
+		// Wait for render thread to finish, so that the back buffer is no longer in use
 		Fence.BeginFence();
 		Fence.Wait();
 	}
@@ -260,22 +376,125 @@ void FNDIConnectionService::OnActiveViewportBackbufferPreResize(void* Backbuffer
 void FNDIConnectionService::OnActiveViewportBackbufferReadyToPresent(SWindow& Window,
 																	 const FTexture2DRHIRef& Backbuffer)
 {
-	if (Window.GetType() == EWindowType::GameWindow || (Window.IsRegularWindow() && IsRunningInPIE()))
+	if (IsActiveViewportWindow(Window))
 	{
-		FTextureResource* TextureResource = GetVideoTextureResource();
-		if (TextureResource != nullptr)
+		// The sender converts straight from the back buffer, without copying it to a render target first
+		if (IsValid(this->ActiveViewportSender))
 		{
-			// Lets improve the performance a bit
-			if (TextureResource->TextureRHI != Backbuffer)
+			this->ActiveViewportSender->ChangeInputTextureRHI(Backbuffer);
+		}
+	}
+	else if (bIsBroadcastingEveryWindow && IsValid(this->ActiveViewportSender))
+	{
+		// Windows without a stream are ignored by the sender
+		this->ActiveViewportSender->ChangeTextureStreamInputRHI(&Window, Backbuffer);
+	}
+}
+
+bool FNDIConnectionService::IsActiveViewportWindow(const SWindow& Window) const
+{
+	return Window.GetType() == EWindowType::GameWindow || (Window.IsRegularWindow() && IsRunningInPIE());
+}
+
+// Handler for when the game thread frame has ended
+void FNDIConnectionService::OnEndFrame()
+{
+	if (bIsBroadcastingActiveViewport && bIsBroadcastingEveryWindow)
+	{
+		UpdateWindowOutputs();
+	}
+}
+
+// Adds a stream of the active viewport sender for each window which has none, and removes those of the windows
+// which are gone
+void FNDIConnectionService::UpdateWindowOutputs()
+{
+	check(IsInGameThread());
+
+	if (!IsValid(this->ActiveViewportSender))
+		return;
+
+	TArray<TSharedRef<SWindow>> Windows;
+	FSlateApplication::Get().GetAllVisibleWindowsOrdered(Windows);
+
+	// Only regular windows are broadcast, not menus, tool-tips or notifications
+	Windows.RemoveAll([this](const TSharedRef<SWindow>& Window) {
+		return !Window->IsRegularWindow() || IsActiveViewportWindow(*Window);
+	});
+
+	WindowOutputs.RemoveAll([this, &Windows](const FWindowOutput& Output) {
+		TSharedPtr<SWindow> Window = Output.Window.Pin();
+		if (Window.IsValid() && Windows.Contains(Window.ToSharedRef()))
+			return false;
+
+		this->ActiveViewportSender->RemoveTextureStream(Output.WindowKey);
+		return true;
+	});
+
+	for (const TSharedRef<SWindow>& Window : Windows)
+	{
+		// Windows are broadcast at their own size, within the limits of the application outputs
+		FVector2D WindowSize = Window->GetSizeInScreen();
+		FIntPoint FrameSize(FMath::Clamp(FMath::RoundToInt(WindowSize.X), 240, UNDIIOPluginSettings::MaxBroadcastFrameSize) & ~1,
+		                    FMath::Clamp(FMath::RoundToInt(WindowSize.Y), 240, UNDIIOPluginSettings::MaxBroadcastFrameSize));
+
+		FWindowOutput* ExistingOutput = WindowOutputs.FindByPredicate([&Window](const FWindowOutput& Output) {
+			return Output.WindowKey == &Window.Get();
+		});
+
+		if (ExistingOutput != nullptr)
+		{
+			if (ExistingOutput->FrameSize != FrameSize)
 			{
-				TextureResource->TextureRHI = (FTexture2DRHIRef&)Backbuffer;
-				this->ActiveViewportSender->ChangeVideoTexture(VideoTexture);
-				RHIUpdateTextureReference(VideoTexture->TextureReference.TextureReferenceRHI, Backbuffer);
+				ExistingOutput->FrameSize = FrameSize;
+				this->ActiveViewportSender->ChangeTextureStream(ExistingOutput->WindowKey, ExistingOutput->StreamName, FrameSize);
 			}
+			continue;
 		}
+
+		FString StreamName = GetUniqueWindowStreamName(*Window);
+
+		FWindowOutput& Output = WindowOutputs.AddDefaulted_GetRef();
+		Output.Window = Window;
+		Output.WindowKey = &Window.Get();
+		Output.StreamName = StreamName;
+		Output.FrameSize = FrameSize;
+
+		this->ActiveViewportSender->ChangeTextureStream(Output.WindowKey, Output.StreamName, FrameSize);
 	}
 }
 
+// Returns the name of the stream of a window, which is suffixed when another window already has the same title
+FString FNDIConnectionService::GetUniqueWindowStreamName(const SWindow& Window) const
+{
+	FString WindowTitle = Window.GetTitle().ToString();
+	if (WindowTitle.IsEmpty())
+		WindowTitle = TEXT("Window");
+
+	FString BaseName = WindowStreamName + TEXT(" (") + WindowTitle;
+	FString StreamName = BaseName + TEXT(")");
+
+	auto IsNameTaken = [this](const FString& Name) {
+		return WindowOutputs.ContainsByPredicate([&Name](const FWindowOutput& Output) { return Output.StreamName == Name; });
+	};
+
+	for (int32 Suffix = 2; IsNameTaken(StreamName); ++Suffix)
+		StreamName = FString::Printf(TEXT("%s %d)"), *BaseName, Suffix);
+
+	return StreamName;
+}
+
+void FNDIConnectionService::DestroyWindowOutputs()
+{
+	if (IsValid(this->ActiveViewportSender))
+	{
+		for (const FWindowOutput& Output : WindowOutputs)
+			this->ActiveViewportSender->RemoveTextureStream(Output.WindowKey);
+	}
+
+	WindowOutputs.Empty();
+}
+
 void FNDIConnectionService::StopBroadcastingActiveViewport()
 {
 	// Wait for the sync context locks
@@ -284,71 +503,197 @@ void FNDIConnectionService::StopBroadcastingActiveViewport()
 	// reset the initialization properties
 	bIsInPIEMode = false;
 
-	if (bIsAudioInitialized)
-	{
-		if (GEngine)
-		{
-			FAudioDeviceHandle AudioDevice = GEngine->GetMainAudioDevice();
-			if (AudioDevice)
-			{
-				AudioDevice->UnregisterSubmixBufferListener(this);
-			}
-		}
-		bIsAudioInitialized = false;
-	}
+	UnregisterSubmixListeners();
 
 	// Ensure that if the active viewport sender is active, that we shut it down
 	if (IsValid(this->ActiveViewportSender))
 	{
 		FSlateApplication::Get().GetRenderer()->OnPreResizeWindowBackBuffer().RemoveAll(this);
 		FSlateApplication::Get().GetRenderer()->OnBackBufferReadyToPresent().RemoveAll(this);
+		FSlateApplication::Get().GetRenderer()->OnSlateWindowDestroyed().RemoveAll(this);
+		FCoreDelegates::OnEndFrame.RemoveAll(this);
 
 		// shutdown the active viewport sender (just in case it was activated)
 		this->ActiveViewportSender->Shutdown();
 
+		// shutdown the senders of the other windows
+		DestroyWindowOutputs();
+		this->bIsBroadcastingEveryWindow = false;
+
 		// reset the broadcasting flag, so that we can restart the broadcast later
 		this->bIsBroadcastingActiveViewport = false;
+	}
+}
+
 
-		FTextureResource* TextureResource = GetVideoTextureResource();
-		if (TextureResource != nullptr)
+void FNDIConnectionService::OnNewSubmixBuffer(const USoundSubmix* OwningSubmix, float* AudioData, int32 NumSamples, int32 NumChannels, const int32 SampleRate, double AudioClock)
+{
+	if ((NumSamples > 0) && (NumChannels > 0))
+	{
+		FScopeLock Lock(&AudioSyncContext);
+
+		if (bIsAudioInitialized && FNDIConnectionService::EventOnSendAudioFrame.IsBound())
 		{
-			TextureResource->TextureRHI.SafeRelease();
-			this->ActiveViewportSender->ChangeVideoTexture(VideoTexture);
+			int64 ticks = GetAudioTimecode(OwningSubmix, NumSamples / NumChannels, SampleRate, AudioClock);
+
+			// Reuse the audio frame of this submix, unless a sender is still holding on to it
+			FNDISubmixAudioFramePtr& AudioFrame = SubmixAudioFrames.FindOrAdd(OwningSubmix);
+			if (!AudioFrame.IsValid() || !AudioFrame.IsUnique())
+			{
+				AudioFrame = MakeShared<FNDISubmixAudioFrame, ESPMode::ThreadSafe>();
+			}
+
+			AudioFrame->Submix = OwningSubmix;
+			AudioFrame->bIsMainSubmix = (MainSubmix == nullptr) || (OwningSubmix == MainSubmix);
+			AudioFrame->Timecode = ticks;
+			AudioFrame->NumSamples = NumSamples / NumChannels;
+			AudioFrame->NumChannels = NumChannels;
+			AudioFrame->SampleRate = SampleRate;
+			AudioFrame->AudioClock = AudioClock;
+			AudioFrame->ChannelStrideInBytes = AudioFrame->NumSamples * sizeof(float);
+			AudioFrame->PlanarData.SetNumUninitialized(NumSamples, false);
+
+			// Convert from the interleaved audio that Unreal Engine produces, once for all the senders
+			NDIlib_audio_frame_interleaved_32f_t NDI_interleaved_audio_frame;
+			NDI_interleaved_audio_frame.timecode = ticks;
+			NDI_interleaved_audio_frame.sample_rate = SampleRate;
+			NDI_interleaved_audio_frame.no_channels = NumChannels;
+			NDI_interleaved_audio_frame.no_samples = AudioFrame->NumSamples;
+			NDI_interleaved_audio_frame.p_data = AudioData;
+
+			NDIlib_audio_frame_v2_t NDI_audio_frame;
+			NDI_audio_frame.p_data = AudioFrame->PlanarData.GetData();
+			NDI_audio_frame.channel_stride_in_bytes = AudioFrame->ChannelStrideInBytes;
+
+			NDIlib_util_audio_from_interleaved_32f_v2(&NDI_interleaved_audio_frame, &NDI_audio_frame);
+
+			FNDIConnectionService::EventOnSendAudioFrame.Broadcast(AudioFrame);
 		}
 	}
 }
 
 
-FTextureResource* FNDIConnectionService::GetVideoTextureResource() const
+/**
+	Returns the timecode (in 100ns units) of the video frames sent at the end of this render frame.
+	With the frame counter, the timecode is the frame of the broadcast rate which the media clock is in, computed
+	from the frame index in integers; engine frames falling in the same frame share its timecode, and frames the
+	engine skips are skipped. With the audio clock, it is the last audio clock moved on by the time elapsed since,
+	so that video follows the audio device rather than the system clock.
+*/
+int64 FNDIConnectionService::GetVideoTimecode()
 {
-	if(IsValid(this->VideoTexture))
-#if ENGINE_MAJOR_VERSION == 5
-		return this->VideoTexture->GetResource();
-#elif ENGINE_MAJOR_VERSION == 4
-		return this->VideoTexture->Resource;
-#else
-		#error "Unsupported engine major version"
-		return nullptr;
-#endif
+	FScopeLock Lock(&MediaClockSyncContext);
 
-	return nullptr;
-}
+	int64 TimeOfDay = FDateTime::Now().GetTimeOfDay().GetTicks();
 
+	if ((TimecodeSource == ENDITimecodeSource::FrameCounter) && (TimecodeFrameRate.Numerator > 0))
+	{
+		if (!bHasTimecodeEpoch)
+			StartMediaClock(TimeOfDay);
 
-void FNDIConnectionService::OnNewSubmixBuffer(const USoundSubmix* OwningSubmix, float* AudioData, int32 NumSamples, int32 NumChannels, const int32 SampleRate, double AudioClock)
+		// Never go back a frame, should the audio clock read slightly behind the cycle clock it took over from
+		int64 FrameIndex = (int64)FMath::FloorToDouble(GetMediaClockSeconds() * TimecodeFrameRate.AsDecimal());
+		LastVideoFrameIndex = FMath::Max(LastVideoFrameIndex, FrameIndex);
+
+		int64 Seconds = LastVideoFrameIndex / TimecodeFrameRate.Numerator;
+		int64 Remainder = LastVideoFrameIndex % TimecodeFrameRate.Numerator;
+		return TimecodeEpoch + (Seconds * TimecodeFrameRate.Denominator * ETimespan::TicksPerSecond)
+			+ (Remainder * TimecodeFrameRate.Denominator * ETimespan::TicksPerSecond) / TimecodeFrameRate.Numerator;
+	}
+	else if ((TimecodeSource == ENDITimecodeSource::AudioClock) && bHasTimecodeEpoch)
+	{
+		double Elapsed = (FPlatformTime::Cycles64() - LastAudioClockCycles) * FPlatformTime::GetSecondsPerCycle64();
+		return TimecodeEpoch + (int64)FMath::RoundToDouble((LastAudioClock + Elapsed) * ETimespan::TicksPerSecond);
+	}
+
+	// The system clock, or the audio clock until the audio device has started
+	return TimeOfDay;
+}
+
+/**
+	Returns the timecode (in 100ns units) of the first sample of a buffer of audio of a submix.
+	With the frame counter, the timecode is computed from the number of samples of the submix sent before, in
+	integers, and the samples counted move the media clock on; with the audio clock, it is the sample clock of
+	the audio device.
+*/
+int64 FNDIConnectionService::GetAudioTimecode(const USoundSubmix* Submix, int32 NumSamples, int32 SampleRate, double AudioClock)
 {
-	if (NumSamples > 0)
+	FScopeLock Lock(&MediaClockSyncContext);
+
+	int64 TimeOfDay = FDateTime::Now().GetTimeOfDay().GetTicks();
+
+	if ((TimecodeSource == ENDITimecodeSource::FrameCounter) && (SampleRate > 0))
 	{
-		FScopeLock Lock(&AudioSyncContext);
+		if (!bHasTimecodeEpoch)
+			StartMediaClock(TimeOfDay);
 
-		if (bIsAudioInitialized)
+		// A submix first heard after the clock has started begins at the current media time, rather than at the
+		// epoch, which would stamp its audio in the past
+		int64* SampleIndexPtr = SubmixSampleCounts.Find(Submix);
+		if (SampleIndexPtr == nullptr)
 		{
-			int64 ticks = FDateTime::Now().GetTimeOfDay().GetTicks();
+			int64 FirstSampleIndex = (int64)FMath::RoundToDouble(GetMediaClockSeconds() * SampleRate);
+			SampleIndexPtr = &SubmixSampleCounts.Add(Submix, FirstSampleIndex);
+		}
 
-			if (FNDIConnectionService::EventOnSendAudioFrame.IsBound())
-			{
-				FNDIConnectionService::EventOnSendAudioFrame.Broadcast(ticks, AudioData, NumSamples, NumChannels, SampleRate, AudioClock);
-			}
+		int64& SampleIndex = *SampleIndexPtr;
+		int64 Timecode = TimecodeEpoch + (SampleIndex * ETimespan::TicksPerSecond) / SampleRate;
+		double SampleClock = (double)SampleIndex / SampleRate;
+		SampleIndex += NumSamples;
+
+		// Every submix is rendered by the same audio device, so any of them moves the clock on
+		if (SampleClock >= LastAudioClock)
+		{
+			LastAudioClock = SampleClock;
+			LastAudioClockCycles = FPlatformTime::Cycles64();
 		}
+
+		return Timecode;
 	}
+	else if (TimecodeSource == ENDITimecodeSource::AudioClock)
+	{
+		// The audio clock starts with the audio device, so it is offset to read as the time of day
+		if (!bHasTimecodeEpoch)
+		{
+			TimecodeEpoch = TimeOfDay - (int64)FMath::RoundToDouble(AudioClock * ETimespan::TicksPerSecond);
+			bHasTimecodeEpoch = true;
+		}
+
+		// Every submix is rendered by the same audio device, so any of them moves the clock on
+		if (AudioClock >= LastAudioClock)
+		{
+			LastAudioClock = AudioClock;
+			LastAudioClockCycles = FPlatformTime::Cycles64();
+		}
+
+		return TimecodeEpoch + (int64)FMath::RoundToDouble(AudioClock * ETimespan::TicksPerSecond);
+	}
+
+	return TimeOfDay;
+}
+
+/**
+	Starts the media clock of the frame counter at the time of day given
+*/
+void FNDIConnectionService::StartMediaClock(int64 TimeOfDay)
+{
+	TimecodeEpoch = TimeOfDay;
+	TimecodeEpochCycles = FPlatformTime::Cycles64();
+	bHasTimecodeEpoch = true;
+}
+
+/**
+	Returns the time (in seconds) elapsed on the media clock of the frame counter since its epoch.
+	The clock is the count of audio samples sent, moved on by the cycle clock since the last buffer, so that video
+	frames follow the audio samples rather than the engine frames; until the first buffer of audio, it is the cycle
+	clock since the epoch.
+*/
+double FNDIConnectionService::GetMediaClockSeconds() const
+{
+	uint64 NowCycles = FPlatformTime::Cycles64();
+
+	if (LastAudioClockCycles != 0)
+		return LastAudioClock + (NowCycles - LastAudioClockCycles) * FPlatformTime::GetSecondsPerCycle64();
+
+	return (NowCycles - TimecodeEpochCycles) * FPlatformTime::GetSecondsPerCycle64();
 }
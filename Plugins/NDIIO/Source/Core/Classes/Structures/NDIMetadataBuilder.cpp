@@ -0,0 +1,251 @@
+/*
+	Copyright (C) 2023 Vizrt NDI AB. All rights reserved.
+
+	This file and it's use within a Product is bound by the terms of NDI SDK license that was provided
+	as part of the NDI SDK. For more information, please review the license and the NDI SDK documentation.
+*/
+
+#include <Structures/NDIMetadataBuilder.h>
+
+/** ************************ **/
+
+FNDIMetadataBufferPool& FNDIMetadataBufferPool::Get()
+{
+	static FNDIMetadataBufferPool Pool;
+	return Pool;
+}
+
+FNDIMetadataBufferPool::~FNDIMetadataBufferPool()
+{
+	for (int32 SizeClass = 0; SizeClass < NumSizeClasses; ++SizeClass)
+	{
+		for (char* Buffer : FreeBuffers[SizeClass])
+			FMemory::Free(Buffer);
+		FreeBuffers[SizeClass].Empty();
+	}
+}
+
+int32 FNDIMetadataBufferPool::GetSizeClass(int32 Capacity)
+{
+	int32 SizeClass = 0;
+	int32 SizeClassBytes = MinSizeClassBytes;
+	while ((SizeClassBytes < Capacity) && (SizeClass < NumSizeClasses))
+	{
+		SizeClassBytes *= 2;
+		++SizeClass;
+	}
+	return SizeClass;
+}
+
+/**
+	Returns a buffer of at least MinCapacity bytes, along with its actual capacity
+*/
+char* FNDIMetadataBufferPool::Acquire(int32 MinCapacity, int32& OutCapacity)
+{
+	int32 SizeClass = GetSizeClass(MinCapacity);
+
+	// Buffers beyond the largest size class are not pooled
+	if (SizeClass >= NumSizeClasses)
+	{
+		++NumAllocations;
+		OutCapacity = MinCapacity;
+		return static_cast<char*>(FMemory::Malloc(MinCapacity));
+	}
+
+	OutCapacity = MinSizeClassBytes << SizeClass;
+
+	{
+		FScopeLock Lock(&SyncContext);
+
+		TArray<char*>& Buffers = FreeBuffers[SizeClass];
+		if (Buffers.Num() > 0)
+			return Buffers.Pop(false);
+	}
+
+	++NumAllocations;
+	return static_cast<char*>(FMemory::Malloc(OutCapacity));
+}
+
+/**
+	Returns a buffer obtained from Acquire to the pool
+*/
+void FNDIMetadataBufferPool::Release(char* Buffer, int32 Capacity)
+{
+	if (Buffer == nullptr)
+		return;
+
+	int32 SizeClass = GetSizeClass(Capacity);
+	if ((SizeClass >= NumSizeClasses) || (Capacity != (MinSizeClassBytes << SizeClass)))
+	{
+		FMemory::Free(Buffer);
+		return;
+	}
+
+	FScopeLock Lock(&SyncContext);
+	FreeBuffers[SizeClass].Push(Buffer);
+}
+
+/** ************************ **/
+
+FNDIMetadataBuilder::~FNDIMetadataBuilder()
+{
+	Empty();
+}
+
+/**
+	Clears the content, keeping the buffer for the next metadata
+*/
+void FNDIMetadataBuilder::Reset()
+{
+	Length = 0;
+	if (Data != nullptr)
+		Data[0] = '\0';
+}
+
+/**
+	Clears the content, and returns the buffer to the pool
+*/
+void FNDIMetadataBuilder::Empty()
+{
+	FNDIMetadataBufferPool::Get().Release(Data, Capacity);
+	Data = nullptr;
+	Length = 0;
+	Capacity = 0;
+}
+
+/**
+	Exchanges the content and buffers of two builders
+*/
+void FNDIMetadataBuilder::Swap(FNDIMetadataBuilder& Other)
+{
+	::Swap(Data, Other.Data);
+	::Swap(Length, Other.Length);
+	::Swap(Capacity, Other.Capacity);
+}
+
+/**
+	Ensures the buffer can hold NumBytes, including the terminating null
+*/
+void FNDIMetadataBuilder::Reserve(int32 NumBytes)
+{
+	if (NumBytes <= Capacity)
+		return;
+
+	// Move to a buffer of a larger size class
+	int32 NewCapacity = 0;
+	char* NewData = FNDIMetadataBufferPool::Get().Acquire(NumBytes, NewCapacity);
+
+	if (Length > 0)
+		FMemory::Memcpy(NewData, Data, Length);
+	NewData[Length] = '\0';
+
+	FNDIMetadataBufferPool::Get().Release(Data, Capacity);
+
+	Data = NewData;
+	Capacity = NewCapacity;
+}
+
+FNDIMetadataBuilder& FNDIMetadataBuilder::Append(const TCHAR* Text, int32 TextLen)
+{
+	if (TextLen <= 0)
+		return *this;
+
+	// A TCHAR never encodes to more than 4 bytes of UTF-8, but mostly to 1
+	Reserve(Length + TextLen * 4 + 1);
+
+	char* Out = Data + Length;
+	for (int32 Index = 0; Index < TextLen; ++Index)
+	{
+		uint32 Code = static_cast<uint32>(Text[Index]);
+
+		if (Code < 0x80)
+		{
+			*Out++ = static_cast<char>(Code);
+			continue;
+		}
+
+		// Combine UTF-16 surrogate pairs
+		if ((Code >= 0xD800) && (Code <= 0xDBFF) && (Index + 1 < TextLen))
+		{
+			uint32 Low = static_cast<uint32>(Text[Index + 1]);
+			if ((Low >= 0xDC00) && (Low <= 0xDFFF))
+			{
+				Code = 0x10000 + ((Code - 0xD800) << 10) + (Low - 0xDC00);
+				++Index;
+			}
+		}
+
+		if (Code < 0x800)
+		{
+			*Out++ = static_cast<char>(0xC0 | (Code >> 6));
+			*Out++ = static_cast<char>(0x80 | (Code & 0x3F));
+		}
+		else if (Code < 0x10000)
+		{
+			*Out++ = static_cast<char>(0xE0 | (Code >> 12));
+			*Out++ = static_cast<char>(0x80 | ((Code >> 6) & 0x3F));
+			*Out++ = static_cast<char>(0x80 | (Code & 0x3F));
+		}
+		else
+		{
+			*Out++ = static_cast<char>(0xF0 | (Code >> 18));
+			*Out++ = static_cast<char>(0x80 | ((Code >> 12) & 0x3F));
+			*Out++ = static_cast<char>(0x80 | ((Code >> 6) & 0x3F));
+			*Out++ = static_cast<char>(0x80 | (Code & 0x3F));
+		}
+	}
+
+	Length = static_cast<int32>(Out - Data);
+	Data[Length] = '\0';
+
+	return *this;
+}
+
+FNDIMetadataBuilder& FNDIMetadataBuilder::AppendUTF8(const char* Text, int32 TextLen)
+{
+	if (TextLen <= 0)
+		return *this;
+
+	Reserve(Length + TextLen + 1);
+
+	FMemory::Memcpy(Data + Length, Text, TextLen);
+	Length += TextLen;
+	Data[Length] = '\0';
+
+	return *this;
+}
+
+/**
+	Appends <Element>ElementData</Element>
+*/
+FNDIMetadataBuilder& FNDIMetadataBuilder::AddElement(const FString& Element, const FString& ElementData)
+{
+	AppendUTF8("<", 1).Append(Element).AppendUTF8(">", 1);
+	Append(ElementData);
+	return AppendUTF8("</", 2).Append(Element).AppendUTF8(">", 1);
+}
+
+/**
+	Appends <Element, to be followed by attributes and CloseEmptyElement
+*/
+FNDIMetadataBuilder& FNDIMetadataBuilder::OpenElement(const FString& Element)
+{
+	return AppendUTF8("<", 1).Append(Element);
+}
+
+/**
+	Appends Key="Value"
+*/
+FNDIMetadataBuilder& FNDIMetadataBuilder::AddAttribute(const FString& Key, const FString& Value)
+{
+	AppendUTF8(" ", 1).Append(Key).AppendUTF8("=\"", 2);
+	return Append(Value).AppendUTF8("\"", 1);
+}
+
+/**
+	Appends />
+*/
+FNDIMetadataBuilder& FNDIMetadataBuilder::CloseEmptyElement()
+{
+	return AppendUTF8("/>", 2);
+}
@@ -0,0 +1,61 @@
+/*
+	Copyright (C) 2023 Vizrt NDI AB. All rights reserved.
+
+	This file and it's use within a Product is bound by the terms of NDI SDK license that was provided
+	as part of the NDI SDK. For more information, please review the license and the NDI SDK documentation.
+*/
+
+#include <Structures/NDIMultiviewerTile.h>
+
+/** Copies an existing instance to this object */
+FNDIMultiviewerTile::FNDIMultiviewerTile(const FNDIMultiviewerTile& other)
+{
+	// perform a deep copy of the 'other' structure and store the values in this object
+	this->Source = other.Source;
+	this->Label = other.Label;
+	this->Tally = other.Tally;
+}
+
+/** Copies existing instance properties to this object */
+FNDIMultiviewerTile& FNDIMultiviewerTile::operator=(const FNDIMultiviewerTile& other)
+{
+	// perform a deep copy of the 'other' structure
+	this->Source = other.Source;
+	this->Label = other.Label;
+	this->Tally = other.Tally;
+
+	// return the result of the copy
+	return *this;
+}
+
+/** Compares this object to 'other' and returns a determination of whether they are equal */
+bool FNDIMultiviewerTile::operator==(const FNDIMultiviewerTile& other) const
+{
+	// return the value of a deep compare against the 'other' structure
+	return this->Source == other.Source && this->Label == other.Label && this->Tally == other.Tally;
+}
+
+/** Returns the label shown for the tile */
+FString FNDIMultiviewerTile::GetDisplayLabel() const
+{
+	if (!this->Label.IsEmpty())
+		return this->Label;
+
+	return this->Source.SourceName.IsEmpty() ? this->Source.GetNDIName() : this->Source.SourceName;
+}
+
+/** Attempts to serialize this object using an Archive object */
+FArchive& FNDIMultiviewerTile::Serialize(FArchive& Ar)
+{
+	// we want to make sure that we are able to serialize this object, over many different version of this structure
+	int32 current_version = 0;
+
+	// serialize this structure
+	return Ar << current_version << this->Source << this->Label << this->Tally;
+}
+
+/** Compares this object to 'other" and returns a determination of whether they are NOT equal */
+bool FNDIMultiviewerTile::operator!=(const FNDIMultiviewerTile& other) const
+{
+	return !(*this == other);
+}
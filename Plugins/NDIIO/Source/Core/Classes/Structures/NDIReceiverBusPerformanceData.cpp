@@ -0,0 +1,73 @@
+/*
+	Copyright (C) 2023 Vizrt NDI AB. All rights reserved.
+
+	This file and it's use within a Product is bound by the terms of NDI SDK license that was provided
+	as part of the NDI SDK. For more information, please review the license and the NDI SDK documentation.
+*/
+
+#include <Structures/NDIReceiverBusPerformanceData.h>
+
+/** Copies an existing instance to this object */
+FNDIReceiverBusPerformanceData::FNDIReceiverBusPerformanceData(const FNDIReceiverBusPerformanceData& other)
+{
+	// perform a deep copy of the 'other' structure and store the values in this object
+	this->StandbyConnections = other.StandbyConnections;
+	this->StandbyVideoFrames = other.StandbyVideoFrames;
+	this->StandbyVideoDataRate = other.StandbyVideoDataRate;
+	this->Cuts = other.Cuts;
+	this->ColdCuts = other.ColdCuts;
+	this->CutLatency = other.CutLatency;
+}
+
+/** Copies existing instance properties to this object */
+FNDIReceiverBusPerformanceData& FNDIReceiverBusPerformanceData::operator=(const FNDIReceiverBusPerformanceData& other)
+{
+	// perform a deep copy of the 'other' structure
+	this->StandbyConnections = other.StandbyConnections;
+	this->StandbyVideoFrames = other.StandbyVideoFrames;
+	this->StandbyVideoDataRate = other.StandbyVideoDataRate;
+	this->Cuts = other.Cuts;
+	this->ColdCuts = other.ColdCuts;
+	this->CutLatency = other.CutLatency;
+
+	// return the result of the copy
+	return *this;
+}
+
+/** Compares this object to 'other' and returns a determination of whether they are equal */
+bool FNDIReceiverBusPerformanceData::operator==(const FNDIReceiverBusPerformanceData& other) const
+{
+	// return the value of a deep compare against the 'other' structure
+	return this->StandbyConnections == other.StandbyConnections && this->StandbyVideoFrames == other.StandbyVideoFrames &&
+		   this->StandbyVideoDataRate == other.StandbyVideoDataRate && this->Cuts == other.Cuts &&
+		   this->ColdCuts == other.ColdCuts && this->CutLatency == other.CutLatency;
+}
+
+/** Resets the current parameters to the default property values */
+void FNDIReceiverBusPerformanceData::Reset()
+{
+	// Ensure we reset all the properties of this object to nominal default properties
+	this->StandbyConnections = 0;
+	this->StandbyVideoFrames = 0;
+	this->StandbyVideoDataRate = 0;
+	this->Cuts = 0;
+	this->ColdCuts = 0;
+	this->CutLatency = 0.f;
+}
+
+/** Attempts to serialize this object using an Archive object */
+FArchive& FNDIReceiverBusPerformanceData::Serialize(FArchive& Ar)
+{
+	// we want to make sure that we are able to serialize this object, over many different version of this structure
+	int32 current_version = 0;
+
+	// serialize this structure
+	return Ar << current_version << this->StandbyConnections << this->StandbyVideoFrames << this->StandbyVideoDataRate
+			  << this->Cuts << this->ColdCuts << this->CutLatency;
+}
+
+/** Compares this object to 'other" and returns a determination of whether they are NOT equal */
+bool FNDIReceiverBusPerformanceData::operator!=(const FNDIReceiverBusPerformanceData& other) const
+{
+	return !(*this == other);
+}
@@ -17,6 +17,15 @@ FNDIReceiverPerformanceData::FNDIReceiverPerformanceData(const FNDIReceiverPerfo
 	this->DroppedVideoFrames = other.DroppedVideoFrames;
 	this->MetadataFrames = other.MetadataFrames;
 	this->VideoFrames = other.VideoFrames;
+	this->TimeToFirstFrame = other.TimeToFirstFrame;
+	this->VideoUploadTime = other.VideoUploadTime;
+	this->PeakVideoUploadTime = other.PeakVideoUploadTime;
+	this->LastFrameAge = other.LastFrameAge;
+	this->Reconnects = other.Reconnects;
+	this->AudioVideoOffset = other.AudioVideoOffset;
+	this->VideoHoldTime = other.VideoHoldTime;
+	this->AudioDelayTime = other.AudioDelayTime;
+	this->LatchLatency = other.LatchLatency;
 }
 
 /** Copies existing instance properties to this object */
@@ -29,6 +38,15 @@ FNDIReceiverPerformanceData& FNDIReceiverPerformanceData::operator=(const FNDIRe
 	this->DroppedVideoFrames = other.DroppedVideoFrames;
 	this->MetadataFrames = other.MetadataFrames;
 	this->VideoFrames = other.VideoFrames;
+	this->TimeToFirstFrame = other.TimeToFirstFrame;
+	this->VideoUploadTime = other.VideoUploadTime;
+	this->PeakVideoUploadTime = other.PeakVideoUploadTime;
+	this->LastFrameAge = other.LastFrameAge;
+	this->Reconnects = other.Reconnects;
+	this->AudioVideoOffset = other.AudioVideoOffset;
+	this->VideoHoldTime = other.VideoHoldTime;
+	this->AudioDelayTime = other.AudioDelayTime;
+	this->LatchLatency = other.LatchLatency;
 
 	// return the result of the copy
 	return *this;
@@ -41,7 +59,11 @@ bool FNDIReceiverPerformanceData::operator==(const FNDIReceiverPerformanceData&
 	return this->AudioFrames == other.AudioFrames && this->DroppedAudioFrames == other.DroppedAudioFrames &&
 		   this->DroppedMetadataFrames == other.DroppedMetadataFrames &&
 		   this->DroppedVideoFrames == other.DroppedVideoFrames && this->MetadataFrames == other.MetadataFrames &&
-		   this->VideoFrames == other.VideoFrames;
+		   this->VideoFrames == other.VideoFrames && this->TimeToFirstFrame == other.TimeToFirstFrame &&
+		   this->VideoUploadTime == other.VideoUploadTime && this->PeakVideoUploadTime == other.PeakVideoUploadTime &&
+		   this->LastFrameAge == other.LastFrameAge && this->Reconnects == other.Reconnects &&
+		   this->AudioVideoOffset == other.AudioVideoOffset && this->VideoHoldTime == other.VideoHoldTime &&
+		   this->AudioDelayTime == other.AudioDelayTime && this->LatchLatency == other.LatchLatency;
 }
 
 /** Resets the current parameters to the default property values */
@@ -54,17 +76,48 @@ void FNDIReceiverPerformanceData::Reset()
 	this->DroppedVideoFrames = 0;
 	this->MetadataFrames = 0;
 	this->VideoFrames = 0;
+	this->TimeToFirstFrame = 0.f;
+	this->VideoUploadTime = 0.f;
+	this->PeakVideoUploadTime = 0.f;
+	this->LastFrameAge = 0.f;
+	this->Reconnects = 0;
+	this->AudioVideoOffset = 0.f;
+	this->VideoHoldTime = 0.f;
+	this->AudioDelayTime = 0.f;
+	this->LatchLatency = 0.f;
 }
 
 /** Attempts to serialize this object using an Archive object */
 FArchive& FNDIReceiverPerformanceData::Serialize(FArchive& Ar)
 {
 	// we want to make sure that we are able to serialize this object, over many different version of this structure
-	int32 current_version = 0;
+	int32 current_version = 5;
 
 	// serialize this structure
-	return Ar << current_version << this->AudioFrames << this->DroppedAudioFrames << this->DroppedMetadataFrames
-			  << this->DroppedVideoFrames << this->MetadataFrames << this->VideoFrames;
+	Ar << current_version << this->AudioFrames << this->DroppedAudioFrames << this->DroppedMetadataFrames
+	   << this->DroppedVideoFrames << this->MetadataFrames << this->VideoFrames;
+
+	// the time to first frame was added in version 1
+	if (current_version >= 1)
+		Ar << this->TimeToFirstFrame;
+
+	// the video upload times were added in version 2
+	if (current_version >= 2)
+		Ar << this->VideoUploadTime << this->PeakVideoUploadTime;
+
+	// the watchdog statistics were added in version 3
+	if (current_version >= 3)
+		Ar << this->LastFrameAge << this->Reconnects;
+
+	// the audio and video alignment was added in version 4
+	if (current_version >= 4)
+		Ar << this->AudioVideoOffset << this->VideoHoldTime << this->AudioDelayTime;
+
+	// the latch latency was added in version 5
+	if (current_version >= 5)
+		Ar << this->LatchLatency;
+
+	return Ar;
 }
 
 /** Compares this object to 'other" and returns a determination of whether they are NOT equal */
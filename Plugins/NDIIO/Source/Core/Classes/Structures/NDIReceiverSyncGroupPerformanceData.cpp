@@ -0,0 +1,65 @@
+/*
+	Copyright (C) 2023 Vizrt NDI AB. All rights reserved.
+
+	This file and it's use within a Product is bound by the terms of NDI SDK license that was provided
+	as part of the NDI SDK. For more information, please review the license and the NDI SDK documentation.
+*/
+
+#include <Structures/NDIReceiverSyncGroupPerformanceData.h>
+
+/** Copies an existing instance to this object */
+FNDIReceiverSyncGroupPerformanceData::FNDIReceiverSyncGroupPerformanceData(const FNDIReceiverSyncGroupPerformanceData& other)
+{
+	// perform a deep copy of the 'other' structure and store the values in this object
+	this->MatchedSets = other.MatchedSets;
+	this->DroppedFrames = other.DroppedFrames;
+	this->BufferedFrames = other.BufferedFrames;
+	this->MatchSpread = other.MatchSpread;
+}
+
+/** Copies existing instance properties to this object */
+FNDIReceiverSyncGroupPerformanceData& FNDIReceiverSyncGroupPerformanceData::operator=(const FNDIReceiverSyncGroupPerformanceData& other)
+{
+	// perform a deep copy of the 'other' structure
+	this->MatchedSets = other.MatchedSets;
+	this->DroppedFrames = other.DroppedFrames;
+	this->BufferedFrames = other.BufferedFrames;
+	this->MatchSpread = other.MatchSpread;
+
+	// return the result of the copy
+	return *this;
+}
+
+/** Compares this object to 'other' and returns a determination of whether they are equal */
+bool FNDIReceiverSyncGroupPerformanceData::operator==(const FNDIReceiverSyncGroupPerformanceData& other) const
+{
+	// return the value of a deep compare against the 'other' structure
+	return this->MatchedSets == other.MatchedSets && this->DroppedFrames == other.DroppedFrames &&
+		   this->BufferedFrames == other.BufferedFrames && this->MatchSpread == other.MatchSpread;
+}
+
+/** Resets the current parameters to the default property values */
+void FNDIReceiverSyncGroupPerformanceData::Reset()
+{
+	// Ensure we reset all the properties of this object to nominal default properties
+	this->MatchedSets = 0;
+	this->DroppedFrames = 0;
+	this->BufferedFrames = 0;
+	this->MatchSpread = 0.f;
+}
+
+/** Attempts to serialize this object using an Archive object */
+FArchive& FNDIReceiverSyncGroupPerformanceData::Serialize(FArchive& Ar)
+{
+	// we want to make sure that we are able to serialize this object, over many different version of this structure
+	int32 current_version = 0;
+
+	// serialize this structure
+	return Ar << current_version << this->MatchedSets << this->DroppedFrames << this->BufferedFrames << this->MatchSpread;
+}
+
+/** Compares this object to 'other" and returns a determination of whether they are NOT equal */
+bool FNDIReceiverSyncGroupPerformanceData::operator!=(const FNDIReceiverSyncGroupPerformanceData& other) const
+{
+	return !(*this == other);
+}
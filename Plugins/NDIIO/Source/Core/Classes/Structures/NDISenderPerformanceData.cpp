@@ -0,0 +1,97 @@
+/*
+	Copyright (C) 2023 Vizrt NDI AB. All rights reserved.
+
+	This file and it's use within a Product is bound by the terms of NDI SDK license that was provided
+	as part of the NDI SDK. For more information, please review the license and the NDI SDK documentation.
+*/
+
+#include <Structures/NDISenderPerformanceData.h>
+
+/** Copies an existing instance to this object */
+FNDISenderPerformanceData::FNDISenderPerformanceData(const FNDISenderPerformanceData& other)
+{
+	// perform a deep copy of the 'other' structure and store the values in this object
+	this->VideoFrames = other.VideoFrames;
+	this->RepeatedVideoFrames = other.RepeatedVideoFrames;
+	this->DecimatedVideoFrames = other.DecimatedVideoFrames;
+	this->SkippedVideoFrames = other.SkippedVideoFrames;
+	this->UnchangedVideoFrames = other.UnchangedVideoFrames;
+	this->AverageCadenceError = other.AverageCadenceError;
+	this->MaximumCadenceError = other.MaximumCadenceError;
+	this->MetadataFrames = other.MetadataFrames;
+	this->MetadataBufferAllocations = other.MetadataBufferAllocations;
+}
+
+/** Copies existing instance properties to this object */
+FNDISenderPerformanceData& FNDISenderPerformanceData::operator=(const FNDISenderPerformanceData& other)
+{
+	// perform a deep copy of the 'other' structure
+	this->VideoFrames = other.VideoFrames;
+	this->RepeatedVideoFrames = other.RepeatedVideoFrames;
+	this->DecimatedVideoFrames = other.DecimatedVideoFrames;
+	this->SkippedVideoFrames = other.SkippedVideoFrames;
+	this->UnchangedVideoFrames = other.UnchangedVideoFrames;
+	this->AverageCadenceError = other.AverageCadenceError;
+	this->MaximumCadenceError = other.MaximumCadenceError;
+	this->MetadataFrames = other.MetadataFrames;
+	this->MetadataBufferAllocations = other.MetadataBufferAllocations;
+
+	// return the result of the copy
+	return *this;
+}
+
+/** Compares this object to 'other' and returns a determination of whether they are equal */
+bool FNDISenderPerformanceData::operator==(const FNDISenderPerformanceData& other) const
+{
+	// return the value of a deep compare against the 'other' structure
+	return this->VideoFrames == other.VideoFrames && this->RepeatedVideoFrames == other.RepeatedVideoFrames &&
+		   this->DecimatedVideoFrames == other.DecimatedVideoFrames &&
+		   this->SkippedVideoFrames == other.SkippedVideoFrames &&
+		   this->UnchangedVideoFrames == other.UnchangedVideoFrames &&
+		   this->AverageCadenceError == other.AverageCadenceError &&
+		   this->MaximumCadenceError == other.MaximumCadenceError &&
+		   this->MetadataFrames == other.MetadataFrames &&
+		   this->MetadataBufferAllocations == other.MetadataBufferAllocations;
+}
+
+/** Resets the current parameters to the default property values */
+void FNDISenderPerformanceData::Reset()
+{
+	// Ensure we reset all the properties of this object to nominal default properties
+	this->VideoFrames = 0;
+	this->RepeatedVideoFrames = 0;
+	this->DecimatedVideoFrames = 0;
+	this->SkippedVideoFrames = 0;
+	this->UnchangedVideoFrames = 0;
+	this->AverageCadenceError = 0.f;
+	this->MaximumCadenceError = 0.f;
+	this->MetadataFrames = 0;
+	this->MetadataBufferAllocations = 0;
+}
+
+/** Attempts to serialize this object using an Archive object */
+FArchive& FNDISenderPerformanceData::Serialize(FArchive& Ar)
+{
+	// we want to make sure that we are able to serialize this object, over many different version of this structure
+	int32 current_version = 2;
+
+	// serialize this structure
+	Ar << current_version << this->VideoFrames << this->RepeatedVideoFrames << this->DecimatedVideoFrames
+	   << this->SkippedVideoFrames << this->AverageCadenceError << this->MaximumCadenceError;
+
+	// the metadata statistics were added in version 1
+	if (current_version >= 1)
+		Ar << this->MetadataFrames << this->MetadataBufferAllocations;
+
+	// the unchanged frames were added in version 2
+	if (current_version >= 2)
+		Ar << this->UnchangedVideoFrames;
+
+	return Ar;
+}
+
+/** Compares this object to 'other" and returns a determination of whether they are NOT equal */
+bool FNDISenderPerformanceData::operator!=(const FNDISenderPerformanceData& other) const
+{
+	return !(*this == other);
+}
@@ -0,0 +1,52 @@
+/*
+	Copyright (C) 2023 Vizrt NDI AB. All rights reserved.
+
+	This file and it's use within a Product is bound by the terms of NDI SDK license that was provided
+	as part of the NDI SDK. For more information, please review the license and the NDI SDK documentation.
+*/
+
+#include <Structures/NDISenderRegion.h>
+
+/** Copies an existing instance to this object */
+FNDISenderRegion::FNDISenderRegion(const FNDISenderRegion& other)
+{
+	// perform a deep copy of the 'other' structure and store the values in this object
+	this->Name = other.Name;
+	this->Offset = other.Offset;
+	this->Size = other.Size;
+}
+
+/** Copies existing instance properties to this object */
+FNDISenderRegion& FNDISenderRegion::operator=(const FNDISenderRegion& other)
+{
+	// perform a deep copy of the 'other' structure
+	this->Name = other.Name;
+	this->Offset = other.Offset;
+	this->Size = other.Size;
+
+	// return the result of the copy
+	return *this;
+}
+
+/** Compares this object to 'other' and returns a determination of whether they are equal */
+bool FNDISenderRegion::operator==(const FNDISenderRegion& other) const
+{
+	// return the value of a deep compare against the 'other' structure
+	return this->Name == other.Name && this->Offset == other.Offset && this->Size == other.Size;
+}
+
+/** Attempts to serialize this object using an Archive object */
+FArchive& FNDISenderRegion::Serialize(FArchive& Ar)
+{
+	// we want to make sure that we are able to serialize this object, over many different version of this structure
+	int32 current_version = 0;
+
+	// serialize this structure
+	return Ar << current_version << this->Name << this->Offset << this->Size;
+}
+
+/** Compares this object to 'other" and returns a determination of whether they are NOT equal */
+bool FNDISenderRegion::operator!=(const FNDISenderRegion& other) const
+{
+	return !(*this == other);
+}
@@ -0,0 +1,42 @@
+/*
+	Copyright (C) 2023 Vizrt NDI AB. All rights reserved.
+
+	This file and it's use within a Product is bound by the terms of NDI SDK license that was provided
+	as part of the NDI SDK. For more information, please review the license and the NDI SDK documentation.
+*/
+
+#include <Structures/NDIVideoFrame.h>
+
+/** ************************ **/
+
+FNDIReceiverConnection::FNDIReceiverConnection(NDIlib_recv_instance_t InReceiveInstance, NDIlib_framesync_instance_t InFramesyncInstance)
+	: p_receive_instance(InReceiveInstance)
+	, p_framesync_instance(InFramesyncInstance)
+{
+}
+
+FNDIReceiverConnection::~FNDIReceiverConnection()
+{
+	if (p_framesync_instance != nullptr)
+		NDIlib_framesync_destroy(p_framesync_instance);
+
+	if (p_receive_instance != nullptr)
+		NDIlib_recv_destroy(p_receive_instance);
+}
+
+/** ************************ **/
+
+FNDIVideoFrame::FNDIVideoFrame(const TSharedRef<FNDIReceiverConnection, ESPMode::ThreadSafe>& InConnection, const NDIlib_video_frame_v2_t& InFrame)
+	: Connection(InConnection)
+	, Frame(InFrame)
+{
+}
+
+FNDIVideoFrame::~FNDIVideoFrame()
+{
+	// Frames captured through a frame sync are freed to it, the others to the receiver they were captured from
+	if (Connection->GetFramesyncInstance() != nullptr)
+		NDIlib_framesync_free_video(Connection->GetFramesyncInstance(), &Frame);
+	else if (Connection->GetReceiveInstance() != nullptr)
+		NDIlib_recv_free_video_v2(Connection->GetReceiveInstance(), &Frame);
+}
@@ -13,6 +13,7 @@
 #include <Engine/TextureRenderTarget2D.h>
 #include <Components/SceneCaptureComponent2D.h>
 #include <Objects/Media/NDIMediaSender.h>
+#include <Enumerations/NDIViewportCaptureMode.h>
 #include <Misc/FrameRate.h>
 #include <Framework/Application/SlateApplication.h>
 #include <SceneManagement.h>
@@ -22,6 +23,7 @@
 
 #include "NDIViewportCaptureComponent.generated.h"
 
+class FNDIViewportTapExtension;
 
 /**
 	A component used to capture an additional viewport for broadcasting over NDI
@@ -33,6 +35,14 @@ class NDIIO_API UNDIViewportCaptureComponent : public USceneCaptureComponent2D
 	GENERATED_UCLASS_BODY()
 
 private:
+	/**
+		Whether to render the scene again from this component, or to take the frames the game viewport already
+		rendered, which only costs the conversion of the frames instead of a second render of the scene
+	*/
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Capture Settings",
+			  META = (DisplayName = "Capture Mode", AllowPrivateAccess = true))
+	ENDIViewportCaptureMode CaptureMode = ENDIViewportCaptureMode::SceneCapture;
+
 	/**
 		If true, will allow you to override the capture settings by ignoring the default Broadcast Settings
 		in the NDI Media Sender, Potentially Requiring a texture rescale of the capture frame when broadcasting
@@ -113,6 +123,22 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "NDI IO", META = (DisplayName = "Change Capture Settings"))
 	void ChangeCaptureSettings(FIntPoint InCaptureSize, FFrameRate InCaptureRate);
 
+	/**
+		Changes whether to render the scene again from this component, or to take the frames of the game viewport
+
+		@param InCaptureMode Where to get the frames to send from
+	*/
+	UFUNCTION(BlueprintCallable, Category = "NDI IO", META = (DisplayName = "Change Capture Mode"))
+	void ChangeCaptureMode(ENDIViewportCaptureMode InCaptureMode);
+
+	/**
+		Returns where the component currently gets the frames to send from
+	*/
+	ENDIViewportCaptureMode GetCaptureMode() const
+	{
+		return CaptureMode;
+	}
+
 	/**
 		Determines the current tally information. If you specify a timeout then it will wait until it has
 		changed, otherwise it will simply poll it and return the current tally immediately
@@ -145,6 +171,11 @@ private:
 	UFUNCTION()
 	void OnBroadcastConfigurationChanged(UNDIMediaSender* Sender);
 
+	void StartViewportTap();
+	void StopViewportTap();
+
 private:
 	FCriticalSection UpdateRenderContext;
+
+	TSharedPtr<FNDIViewportTapExtension, ESPMode::ThreadSafe> ViewportTapExtension;
 };
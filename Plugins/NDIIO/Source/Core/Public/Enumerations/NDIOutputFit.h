@@ -0,0 +1,31 @@
+/*
+	Copyright (C) 2023 Vizrt NDI AB. All rights reserved.
+
+	This file and it's use within a Product is bound by the terms of NDI SDK license that was provided
+	as part of the NDI SDK. For more information, please review the license and the NDI SDK documentation.
+*/
+
+#pragma once
+
+#include <CoreMinimal.h>
+
+#include "NDIOutputFit.generated.h"
+
+/**
+	How the video of a receiver is scaled to fit the output target it is converted into
+*/
+UENUM(BlueprintType, META = (DisplayName = "NDI Output Fit"))
+enum class ENDIOutputFit : uint8
+{
+	/** Scale the video to fill the output target, regardless of its aspect ratio. */
+	Stretch = 0x00 UMETA(DisplayName = "Stretch"),
+
+	/**
+		Scale the video to fit inside the output target, keeping its aspect ratio. The bars left over are cleared to
+		the clear color of the output target.
+	*/
+	Letterbox = 0x01 UMETA(DisplayName = "Letterbox"),
+
+	/** Scale the video to cover the output target, keeping its aspect ratio, and crop the edges which do not fit. */
+	Fill = 0x02 UMETA(DisplayName = "Fill"),
+};
@@ -0,0 +1,41 @@
+/*
+	Copyright (C) 2023 Vizrt NDI AB. All rights reserved.
+
+	This file and it's use within a Product is bound by the terms of NDI SDK license that was provided
+	as part of the NDI SDK. For more information, please review the license and the NDI SDK documentation.
+*/
+
+#pragma once
+
+#include <CoreMinimal.h>
+
+#include "NDIReceiveProfile.generated.h"
+
+/**
+	What a receiver receives from its source. Metadata is always received.
+*/
+UENUM(BlueprintType, META = (DisplayName = "NDI Receive Profile"))
+enum class ENDIReceiveProfile : uint8
+{
+	/** Receive video and audio. */
+	Full = 0x00 UMETA(DisplayName = "Video and Audio"),
+
+	/**
+		Receive video, and leave the audio of the source to the NDI SDK. The source still sends its audio, which is a
+		small part of the stream, but it is never captured or converted.
+	*/
+	VideoOnly = 0x01 UMETA(DisplayName = "Video Only"),
+
+	/**
+		Receive audio, for feeding sound waves. The source is asked for no video, which leaves only a few hundred
+		kilobits per second of the stream on the network. The receiver does not hook the render thread, and allocates
+		no textures or render targets, so it costs no GPU memory, and no CPU for decoding video.
+	*/
+	AudioOnly = 0x02 UMETA(DisplayName = "Audio Only"),
+
+	/**
+		Receive metadata only, for PTZ control or tally. The source is asked for neither video nor audio, and no frame
+		sync is created, so the receiver costs next to nothing on the network, the CPU and the GPU.
+	*/
+	MetadataOnly = 0x03 UMETA(DisplayName = "Metadata Only"),
+};
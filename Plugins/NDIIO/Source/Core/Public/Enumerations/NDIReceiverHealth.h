@@ -0,0 +1,28 @@
+/*
+	Copyright (C) 2023 Vizrt NDI AB. All rights reserved.
+
+	This file and it's use within a Product is bound by the terms of NDI SDK license that was provided
+	as part of the NDI SDK. For more information, please review the license and the NDI SDK documentation.
+*/
+
+#pragma once
+
+#include <CoreMinimal.h>
+
+#include "NDIReceiverHealth.generated.h"
+
+/**
+	The health of the connection of a receiver to its source, as tracked by the receiver watchdog
+*/
+UENUM(BlueprintType, META = (DisplayName = "NDI Receiver Health"))
+enum class ENDIReceiverHealth : uint8
+{
+	/** The receiver is connected to the source, and receiving from it. */
+	Healthy = 0x00 UMETA(DisplayName = "Healthy"),
+
+	/** The receiver is connected to the source, but has received nothing from it for longer than the frame timeout. */
+	Stalled = 0x01 UMETA(DisplayName = "Stalled"),
+
+	/** The receiver has not been connected to the source for longer than the connection timeout. */
+	Disconnected = 0x02 UMETA(DisplayName = "Disconnected"),
+};
@@ -0,0 +1,28 @@
+/*
+	Copyright (C) 2023 Vizrt NDI AB. All rights reserved.
+
+	This file and it's use within a Product is bound by the terms of NDI SDK license that was provided
+	as part of the NDI SDK. For more information, please review the license and the NDI SDK documentation.
+*/
+
+#pragma once
+
+#include <CoreMinimal.h>
+
+#include "NDITallyState.generated.h"
+
+/**
+	The tally of a source, as shown by a multiviewer
+*/
+UENUM(BlueprintType, META = (DisplayName = "NDI Tally State"))
+enum class ENDITallyState : uint8
+{
+	/** The source is neither on preview nor on program. */
+	Off = 0x00 UMETA(DisplayName = "Off"),
+
+	/** The source is on preview. */
+	Preview = 0x01 UMETA(DisplayName = "Preview"),
+
+	/** The source is on program. */
+	Program = 0x02 UMETA(DisplayName = "Program"),
+};
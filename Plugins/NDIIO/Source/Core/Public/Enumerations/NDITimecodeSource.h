@@ -0,0 +1,28 @@
+/*
+	Copyright (C) 2023 Vizrt NDI AB. All rights reserved.
+
+	This file and it's use within a Product is bound by the terms of NDI SDK license that was provided
+	as part of the NDI SDK. For more information, please review the license and the NDI SDK documentation.
+*/
+
+#pragma once
+
+#include <CoreMinimal.h>
+
+#include "NDITimecodeSource.generated.h"
+
+/**
+	The clock from which the timecodes of the audio and video frames sent are derived
+*/
+UENUM(BlueprintType, META = (DisplayName = "NDI Timecode Source"))
+enum class ENDITimecodeSource : uint8
+{
+	/** The time of day at which each frame is sent, read separately for audio and video. */
+	SystemClock = 0x00 UMETA(DisplayName = "System Clock"),
+
+	/** The sample clock of the audio device, which video frames follow. */
+	AudioClock = 0x01 UMETA(DisplayName = "Audio Clock"),
+
+	/** Exact counters of the audio samples at their sample rate, and of the frames of the broadcast rate on the clock they make. */
+	FrameCounter = 0x02 UMETA(DisplayName = "Frame Counter"),
+};
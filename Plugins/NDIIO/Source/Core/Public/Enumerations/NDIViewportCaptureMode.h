@@ -0,0 +1,34 @@
+/*
+	Copyright (C) 2023 Vizrt NDI AB. All rights reserved.
+
+	This file and it's use within a Product is bound by the terms of NDI SDK license that was provided
+	as part of the NDI SDK. For more information, please review the license and the NDI SDK documentation.
+*/
+
+#pragma once
+
+#include <CoreMinimal.h>
+
+#include "NDIViewportCaptureMode.generated.h"
+
+/**
+	Where a viewport capture component gets the frames it sends from
+*/
+UENUM(BlueprintType, META = (DisplayName = "NDI Viewport Capture Mode"))
+enum class ENDIViewportCaptureMode : uint8
+{
+	/** Render the scene again from the component. */
+	SceneCapture = 0x00 UMETA(DisplayName = "Scene Capture"),
+
+	/** The final colour of the game viewport, after all post-processing. */
+	ViewportFinalColor = 0x01 UMETA(DisplayName = "Viewport Final Color"),
+
+	/** The linear colour of the game viewport, after motion blur and before tone mapping. */
+	ViewportAfterMotionBlur = 0x02 UMETA(DisplayName = "Viewport After Motion Blur"),
+
+	/** The colour of the game viewport, after tone mapping. */
+	ViewportAfterTonemap = 0x03 UMETA(DisplayName = "Viewport After Tonemap"),
+
+	/** The colour of the game viewport, after FXAA. */
+	ViewportAfterFXAA = 0x04 UMETA(DisplayName = "Viewport After FXAA"),
+};
@@ -11,6 +11,8 @@
 
 #include <Misc/FrameRate.h>
 #include <UObject/Object.h>
+#include <Structures/NDISenderRegion.h>
+#include <Enumerations/NDITimecodeSource.h>
 
 #include "NDIIOPluginSettings.generated.h"
 
@@ -33,6 +35,10 @@ public:
 		"\r\nPreferred FrameSize - Indicates the preferred frame size to broadcast the Currently Active Viewport over "
 		"NDI."
 		"\r\nBegin Broadcast On Play - Starts the broadcast of the Currently Active Viewport immediately on Play."
+		"\r\nViewport Regions - Rectangles of the game window broadcast as streams of their own, such as the "
+		"viewports of an nDisplay cluster node."
+		"\r\nBroadcast Every Window - Also broadcasts every other window of the application as a stream of its own."
+		"\r\nTimecode Source - The clock from which the timecodes of all the audio and video frames sent are derived."
 	);
 
 	/** The default name to use when broadcasting the Currently Active Viewport over NDI. */
@@ -44,9 +50,39 @@ public:
 	FFrameRate BroadcastRate = FFrameRate(60, 1);
 
 	/** Indicates the preferred frame size to broadcast the Currently Active Viewport over NDI. */
-	UPROPERTY(Config, EditAnywhere, Category = "NDI IO", META = (DisplayName = "Preferred Broadcast Framesize"))
+	UPROPERTY(Config, EditAnywhere, Category = "NDI IO",
+			  META = (DisplayName = "Preferred Broadcast Framesize", ClampMin = 240, ClampMax = 7680))
 	FIntPoint PreferredFrameSize = FIntPoint(1920, 1080);
 
 	UPROPERTY(Config, EditAnywhere, Category = "NDI IO", META = (DisplayName = "Begin Broadcast On Play"))
 	bool bBeginBroadcastOnPlay = false;
+
+	/**
+		Rectangles (in pixels) of the game window broadcast as streams of their own, such as the viewports of an
+		nDisplay cluster node. They are converted in a single pass and read back together.
+	*/
+	UPROPERTY(Config, EditAnywhere, Category = "NDI IO", META = (DisplayName = "Viewport Regions"))
+	TArray<FNDISenderRegion> ViewportRegions;
+
+	/**
+		Also broadcasts every other window of the application as a stream of its own, at the size of the window.
+		The windows are converted and read back together with the viewport regions. Windows with the same title
+		are told apart by a number.
+	*/
+	UPROPERTY(Config, EditAnywhere, Category = "NDI IO", META = (DisplayName = "Broadcast Every Window"))
+	bool bBroadcastEveryWindow = false;
+
+	/**
+		The clock from which the timecodes of all the audio and video frames sent are derived. The audio clock and
+		the frame counter both stamp video from the sample clock of the audio device, so that video follows audio
+		rather than the engine frames; the frame counter also rounds video timecodes down to whole frames of the
+		Broadcast Rate, and engine frames falling in the same frame share its timecode. Until audio starts, or
+		without audio, video follows the system clock instead.
+	*/
+	UPROPERTY(Config, EditAnywhere, Category = "NDI IO", META = (DisplayName = "Timecode Source"))
+	ENDITimecodeSource TimecodeSource = ENDITimecodeSource::SystemClock;
+
+public:
+	/** The largest frame size (in pixels) broadcast over NDI by the application outputs, which is 8K */
+	static constexpr int32 MaxBroadcastFrameSize = 7680;
 };
\ No newline at end of file
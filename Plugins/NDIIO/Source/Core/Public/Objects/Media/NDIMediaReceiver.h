@@ -14,14 +14,22 @@
 #include <Misc/FrameRate.h>
 #include <TimeSynchronizableMediaSource.h>
 #include <RendererInterface.h>
+#include <Engine/TextureRenderTarget2D.h>
 
+#include <Enumerations/NDIOutputFit.h>
+#include <Enumerations/NDIReceiveProfile.h>
+#include <Enumerations/NDIReceiverHealth.h>
 #include <Objects/Media/NDIMediaSoundWave.h>
 #include <Objects/Media/NDIMediaTexture2D.h>
 #include <Structures/NDIConnectionInformation.h>
 #include <Structures/NDIReceiverPerformanceData.h>
+#include <Structures/NDIVideoFrame.h>
+
+#include <atomic>
 
 #include "NDIMediaReceiver.generated.h"
 
+class FNDIReceiverLatchExtension;
 
 namespace NDIMediaOption
 {
@@ -39,6 +47,11 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FNDIMediaReceiverVideoReceived, UNDI
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FNDIMediaReceiverAudioReceived, UNDIMediaReceiver*, Receiver);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(FNDIMediaReceiverMetaDataReceived, UNDIMediaReceiver*, Receiver, FString, Data, bool, bAttachedToVideoFrame);
 
+/**
+	Delegate to notify that the watchdog of the NDIMediaReceiver has found the health of its connection changed
+*/
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FNDIMediaReceiverHealthChanged, UNDIMediaReceiver*, Receiver, ENDIReceiverHealth, Health);
+
 
 /**
 	A Media object representing the NDI Receiver for being able to receive Audio, Video, and Metadata over NDI
@@ -58,6 +71,93 @@ public:
 			  META = (DisplayName = "Connection", AllowPrivateAccess = true))
 	FNDIConnectionInformation ConnectionSetting;
 
+	/**
+		What the receiver receives from the source. Receivers feeding only sound waves, or only PTZ and other metadata
+		consumers, ask the source for less, and skip the frame capture on the render thread and its textures.
+		Takes effect on the next call to Initialize.
+	*/
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Settings", META = (DisplayName = "Receive Profile"))
+	ENDIReceiveProfile ReceiveProfile = ENDIReceiveProfile::Full;
+
+	/**
+		Captures and uploads the video at the start of each render frame rather than at the end of the frame before.
+		The frame displayed is then the newest received by the time the render frame starts, at the cost of the upload
+		delaying the scene rendering. This only gains the time the render thread waits between frames, which is often
+		little when it is busy; Latch Latency in the performance data shows how much it gains. The video is still
+		captured at the end of any render frame whose start was missed.
+	*/
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Settings", META = (DisplayName = "Late Latch"))
+	bool bLateLatch = false;
+
+	/**
+		A render target the video is converted straight into, cropped and scaled to fit it in the same pass, rather
+		than into a render target of the receiver's own which would then have to be copied. The video texture shows
+		the output target while one is set.
+	*/
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Settings|Output", META = (DisplayName = "Output Target (optional)"))
+	UTextureRenderTarget2D* OutputTarget = nullptr;
+
+	/** How the video is scaled to fit the output target */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Settings|Output", META = (DisplayName = "Output Fit"))
+	ENDIOutputFit OutputFit = ENDIOutputFit::Letterbox;
+
+	/** The top left corner of the part of the video converted into the output target, as a fraction of the frame */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Settings|Output",
+			  META = (DisplayName = "Output Crop Min", ClampMin = 0.0, ClampMax = 1.0))
+	FVector2D OutputCropMin = FVector2D(0.f, 0.f);
+
+	/** The bottom right corner of the part of the video converted into the output target, as a fraction of the frame */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Settings|Output",
+			  META = (DisplayName = "Output Crop Max", ClampMin = 0.0, ClampMax = 1.0))
+	FVector2D OutputCropMax = FVector2D(1.f, 1.f);
+
+	/**
+		Aligns the audio heard with the video shown, from the timestamps of the frames received, by holding video
+		frames or delaying the audio, whichever is ahead
+	*/
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Settings|Alignment", META = (DisplayName = "Align Audio and Video"))
+	bool bAlignAudioVideo = false;
+
+	/** The time, in milliseconds, the audio is to be heard after the video it goes with is shown */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Settings|Alignment",
+			  META = (DisplayName = "Audio Video Offset", EditCondition = "bAlignAudioVideo"))
+	float AudioVideoOffset = 0.f;
+
+	/** The longest time, in milliseconds, video frames are held for, or the audio is delayed by */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Settings|Alignment",
+			  META = (DisplayName = "Max Alignment", ClampMin = 0.0, EditCondition = "bAlignAudioVideo"))
+	float MaxAlignment = 250.f;
+
+	/**
+		Watches the connection to the source, and reconnects when it has been lost or has stalled, with increasing
+		delays between attempts. The source is looked up again through the finder, in case its address has changed.
+		Off by default, so that existing receivers keep their connection as it was.
+	*/
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Settings|Watchdog", META = (DisplayName = "Enable Watchdog"))
+	bool bEnableWatchdog = false;
+
+	/** The time, in seconds, the receiver can go without a connection to the source before reconnecting */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Settings|Watchdog",
+			  META = (DisplayName = "Connection Timeout", ClampMin = 0.1, EditCondition = "bEnableWatchdog"))
+	float ConnectionTimeout = 5.f;
+
+	/**
+		The time, in seconds, the receiver can go without receiving anything from a connected source before
+		reconnecting. Zero never reconnects to sources which stay connected, such as those sending still images.
+	*/
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Settings|Watchdog",
+			  META = (DisplayName = "Frame Timeout", ClampMin = 0.0, EditCondition = "bEnableWatchdog"))
+	float FrameTimeout = 0.f;
+
+	/** The delay, in seconds, before the first reconnection, doubled after each attempt up to the maximum delay */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Settings|Watchdog",
+			  META = (DisplayName = "Min Reconnect Delay", ClampMin = 0.1, EditCondition = "bEnableWatchdog"))
+	float MinReconnectDelay = 1.f;
+
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Settings|Watchdog",
+			  META = (DisplayName = "Max Reconnect Delay", ClampMin = 0.1, EditCondition = "bEnableWatchdog"))
+	float MaxReconnectDelay = 30.f;
+
 private:
 	/**
 		The current frame count, seconds, minutes, and hours in time-code notation
@@ -108,6 +208,13 @@ private:
 			  META = (DisplayName = "Performance Data", AllowPrivateAccess = true))
 	FNDIReceiverPerformanceData PerformanceData;
 
+	/**
+		The health of the connection to the source, as last found by the watchdog
+	*/
+	UPROPERTY(BlueprintReadOnly, VisibleAnywhere, Category = "Information",
+			  META = (DisplayName = "Health", AllowPrivateAccess = true))
+	ENDIReceiverHealth Health = ENDIReceiverHealth::Healthy;
+
 	/**
 		Provides an NDI Video Texture object to render videos frames from the source onto (optional)
 	*/
@@ -123,6 +230,12 @@ public:
 
 	DECLARE_EVENT_TwoParams(FNDIMediaReceiverVideoCaptureEvent, FOnReceiverVideoCaptureEvent,
 	                        UNDIMediaReceiver*, const NDIlib_video_frame_v2_t&) FOnReceiverVideoCaptureEvent OnNDIReceiverVideoCaptureEvent;
+	/**
+		Broadcast on the render thread with each new video frame, for C++ subscribers processing the received pixels.
+		The frame can be kept and read on any thread, and is returned to the NDI SDK once its last reference is released.
+	*/
+	DECLARE_EVENT_TwoParams(FNDIMediaReceiverVideoFrameEvent, FOnReceiverVideoFrameEvent,
+	                        UNDIMediaReceiver*, const FNDIVideoFrameRef&) FOnReceiverVideoFrameEvent OnNDIReceiverVideoFrameEvent;
 	DECLARE_EVENT_TwoParams(FNDIMediaReceiverAudioCaptureEvent, FOnReceiverAudioCaptureEvent,
 	                        UNDIMediaReceiver*, const NDIlib_audio_frame_v2_t&) FOnReceiverAudioCaptureEvent OnNDIReceiverAudioCaptureEvent;
 	DECLARE_EVENT_TwoParams(FNDIMediaReceiverMetadataCaptureEvent, FOnReceiverMetadataCaptureEvent,
@@ -137,6 +250,9 @@ public:
 	UPROPERTY(BlueprintAssignable, Category="NDI Events", META = (DisplayName = "On MetaData Received by Receiver", AllowPrivateAccess = true))
 	FNDIMediaReceiverMetaDataReceived OnReceiverMetaDataReceived;
 
+	UPROPERTY(BlueprintAssignable, Category="NDI Events", META = (DisplayName = "On Health Changed", AllowPrivateAccess = true))
+	FNDIMediaReceiverHealthChanged OnReceiverHealthChanged;
+
 public:
 
 	UNDIMediaReceiver();
@@ -159,7 +275,8 @@ public:
 	bool Initialize(EUsage Inusage);
 
 	/**
-		Attempt to (re-)start the connection
+		Attempt to (re-)start the connection. The connection is established on a worker thread, and the previous
+		connection is kept until the new one has delivered its first frame.
 	*/
 	UFUNCTION(BlueprintCallable, Category = "NDI IO", META = (DisplayName = "Start Connection"))
 	void StartConnection();
@@ -176,6 +293,21 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "NDI IO", META = (DisplayName = "Change Connection"))
 	void ChangeConnection(const FNDIConnectionInformation& InConnectionInformation);
 
+	/**
+		Takes over a connection which is already receiving from the source, so that its frames are displayed from
+		the next frame on. When the connection was made at a lower bandwidth than requested, a connection at the
+		requested bandwidth is made on a worker thread and replaces it once it has delivered its first frame.
+		The receiver takes ownership of both instances.
+	*/
+	void AdoptConnection(const FNDIConnectionInformation& InConnectionInformation, ENDISourceBandwidth InConnectedBandwidth,
+						 NDIlib_recv_instance_t InReceiveInstance, NDIlib_framesync_instance_t InFramesyncInstance);
+
+	/**
+		Destroys a receiver and its frame sync on a worker thread, since the NDI SDK can take a while to close a
+		connection
+	*/
+	static void DestroyConnectionAsync(NDIlib_recv_instance_t InReceiveInstance, NDIlib_framesync_instance_t InFramesyncInstance);
+
 	/**
 		Attempts to change the Video Texture object used as the video frame capture object
 	*/
@@ -248,14 +380,71 @@ public:
 	*/
 	FTextureRHIRef DisplayFrame(const NDIlib_video_frame_v2_t& video_frame);
 
+	/**
+		Displays the video frame, and points the video textures of this object at it, as a standalone receiver does
+		with every frame it captures
+	*/
+	void PresentFrame(const NDIlib_video_frame_v2_t& video_frame);
+
 private:
 	void SetIsCurrentlyConnected(bool bConnected);
 
+	/**
+		Captures the metadata and video of a standalone receiver, at the start of the render frame when late latching,
+		and at its end otherwise; on the render thread
+	*/
+	void OnBeginFrame_RenderThread();
+	void OnEndFrame_RenderThread();
+	void CaptureStandaloneFrame_RenderThread();
+
+	/**
+		Measures how long before the scene rendering the video frame displayed was captured, from the latch extension;
+		on the render thread
+	*/
+	friend class FNDIReceiverLatchExtension;
+	void OnPreRenderViewFamily_RenderThread();
+
+	/**
+		Replaces the current connection with the one established on the worker thread, once it is ready
+	*/
+	void PromotePendingConnection();
+	void CancelPendingConnection();
+
 	/**
 		Attempts to gather the performance metrics of the connection to the remote source
 	*/
 	void GatherPerformanceMetrics();
 
+	/**
+		Checks the health of the connection, and reconnects to the source once it is due
+	*/
+	void UpdateWatchdog();
+	void ReconnectToSource();
+	void StartConnectionAt(const FString& InUrl);
+	void ResetWatchdog();
+	void SetHealth(ENDIReceiverHealth NewHealth);
+
+	bool HasVideoProfile() const
+	{
+		return (ReceiveProfile == ENDIReceiveProfile::Full) || (ReceiveProfile == ENDIReceiveProfile::VideoOnly);
+	}
+	bool ReceivesVideo() const;
+	bool ReceivesAudio() const;
+	NDIlib_recv_bandwidth_e GetReceiveBandwidth() const;
+
+	/**
+		Broadcasts a video frame to the capture events. Returns whether a frame handle has taken over the frame,
+		which is only ever the case for frames which are not already held.
+	*/
+	bool BroadcastVideoFrame(const NDIlib_video_frame_v2_t& video_frame, const FNDIVideoFramePtr& HeldFrame = nullptr);
+	void ReleaseHeldVideoFrames();
+
+	/**
+		Adjusts the video hold time and the audio delay towards the requested offset between audio and video
+	*/
+	void UpdateAudioVideoAlignment();
+	void ResetAudioVideoAlignment();
+
 public:
 	/**
 		Set whether or not a RGB to Linear conversion is made
@@ -296,7 +485,35 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "NDI IO", META = (DisplayName = "Is Currently Connected"))
 	const bool GetIsCurrentlyConnected() const;
 
+	/** Returns the health of the connection to the source, as last found by the watchdog */
+	UFUNCTION(BlueprintCallable, Category = "NDI IO", META = (DisplayName = "Get Health"))
+	ENDIReceiverHealth GetHealth() const;
+
 private:
+	/** The number of textures the video frames are uploaded into in turn */
+	static constexpr int32 SourceTextureRingSize = 3;
+
+	void CreateSourceTextureRing(const TCHAR* Name, const FIntPoint& Size, EPixelFormat Format,
+								 FTexture2DRHIRef (&Ring)[SourceTextureRingSize]);
+	void AdvanceSourceTextureRing();
+	void RecordVideoUploadTime(uint64 UploadStartCycles);
+
+	/** The texture a frame is converted into, the rectangle of it drawn to, and the part of the frame drawn */
+	struct FConversionTarget
+	{
+		FTextureRHIRef Texture;
+		FIntRect Viewport;
+		FVector2D UVOffset = FVector2D(0, 0);
+		FVector2D UVScale = FVector2D(1, 1);
+		ERenderTargetActions Actions = ERenderTargetActions::DontLoad_Store;
+	};
+
+	/**
+		Returns the output target, with the video cropped and fitted to it, when one is set, and otherwise a render
+		target of the frame size from the render target pool
+	*/
+	FConversionTarget GetConversionTarget(FRHICommandListImmediate& RHICmdList, const FIntPoint& FrameSize);
+
 	/**
 		Perform the color conversion (if any) and bit copy from the gpu
 	*/
@@ -313,6 +530,7 @@ private:
 
 	FTextureResource* GetVideoTextureResource() const;
 	FTextureResource* GetInternalVideoTextureResource() const;
+	FTextureResource* GetOutputTargetResource() const;
 
 #if WITH_EDITORONLY_DATA
 	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
@@ -330,9 +548,61 @@ private:
 
 	bool bIsCurrentlyConnected = false;
 
+	/** When the current connection was requested, until it has displayed its first frame */
+	uint64 FirstFrameRequestCycles = 0;
+
 	NDIlib_recv_instance_t p_receive_instance = nullptr;
 	NDIlib_framesync_instance_t p_framesync_instance = nullptr;
 
+	/** When anything was last received from the source, and when its connections were last seen */
+	std::atomic<uint64> LastMediaCycles { 0 };
+	uint64 LastConnectedCycles = 0;
+
+	/** When the watchdog next looks at the connection, and when it next reconnects if it is unhealthy */
+	uint64 NextWatchdogCycles = 0;
+	uint64 NextReconnectCycles = 0;
+	int32 ReconnectAttempts = 0;
+
+	/**
+		The difference between the time of the source and the local time, for the video being shown and the audio
+		being heard, in seconds
+	*/
+	double VideoSourceOffset = 0.0;
+	bool bHasVideoSourceOffset = false;
+	std::atomic<double> AudioSourceOffset { 0.0 };
+	std::atomic<bool> bHasAudioSourceOffset { false };
+
+	/** The time, in seconds, between audio being generated for the sound waves and it being heard */
+	double AudioOutputLatency = 0.0;
+
+	/** Positive to hold the video, negative to delay the audio, in seconds */
+	double SmoothedAudioVideoOffset = 0.0;
+	double AlignmentCorrection = 0.0;
+	double VideoHoldTime = 0.0;
+	std::atomic<double> AudioDelayTime { 0.0 };
+
+	/** Video frames being held, with the local time they were captured at */
+	TArray<TPair<double, FNDIVideoFramePtr>> HeldVideoFrames;
+
+	/** Owns the instances above, and is shared with the frames handed out from them */
+	TSharedPtr<FNDIReceiverConnection, ESPMode::ThreadSafe> CurrentConnection;
+
+	/**
+		The connection being established on a worker thread. It is shared with the worker, so that a connection
+		which completes after it has been superseded, or after this object has been shut down, is destroyed by the
+		worker itself.
+	*/
+	struct FPendingConnection
+	{
+		FCriticalSection SyncContext;
+		uint32 Generation = 0;
+		uint64 RequestCycles = 0;
+
+		NDIlib_recv_instance_t p_receive_instance = nullptr;
+		NDIlib_framesync_instance_t p_framesync_instance = nullptr;
+	};
+	TSharedRef<FPendingConnection, ESPMode::ThreadSafe> PendingConnection = MakeShared<FPendingConnection, ESPMode::ThreadSafe>();
+
 	FCriticalSection RenderSyncContext;
 	FCriticalSection AudioSyncContext;
 	FCriticalSection MetadataSyncContext;
@@ -342,6 +612,9 @@ private:
 
 	UNDIMediaTexture2D* InternalVideoTexture = nullptr;
 
+	FTexture2DRHIRef SourceTextureRing[SourceTextureRingSize];
+	FTexture2DRHIRef SourceAlphaTextureRing[SourceTextureRingSize];
+	int32 SourceTextureRingIndex = 0;
 	FTexture2DRHIRef SourceTexture;
 	FTexture2DRHIRef SourceAlphaTexture;
 	FPooledRenderTargetDesc RenderTargetDescriptor;
@@ -356,6 +629,13 @@ private:
 	};
 	EDrawMode DrawMode = EDrawMode::Invalid;
 
+	FDelegateHandle FrameBeginRTHandle;
 	FDelegateHandle FrameEndRTHandle;
+	FDelegateHandle FrameEndHandle;
+
+	/** Whether the video was captured at the start of the current render frame, and when the last frame was captured */
+	bool bLatchedThisFrame = false;
+	uint64 LastVideoCaptureCycles = 0;
+	TSharedPtr<FNDIReceiverLatchExtension, ESPMode::ThreadSafe> LatchExtension;
 	FDelegateHandle VideoCaptureEventHandle;
 };
\ No newline at end of file
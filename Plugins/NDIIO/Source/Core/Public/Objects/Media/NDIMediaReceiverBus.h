@@ -0,0 +1,128 @@
+/*
+	Copyright (C) 2023 Vizrt NDI AB. All rights reserved.
+
+	This file and it's use within a Product is bound by the terms of NDI SDK license that was provided
+	as part of the NDI SDK. For more information, please review the license and the NDI SDK documentation.
+*/
+
+#pragma once
+
+#include <NDIIOPluginAPI.h>
+
+#include <UObject/Object.h>
+
+#include <Objects/Media/NDIMediaReceiver.h>
+#include <Structures/NDIConnectionInformation.h>
+#include <Structures/NDIReceiverBusPerformanceData.h>
+
+#include "NDIMediaReceiverBus.generated.h"
+
+/**
+	Keeps a set of sources connected in standby at a low bandwidth, so that the program receiver can be cut to any
+	of them on the next frame, the way a switcher cuts between its inputs
+*/
+UCLASS(BlueprintType, Blueprintable, Category = "NDI IO", HideCategories = ("Information"),
+	   META = (DisplayName = "NDI Media Receiver Bus"))
+class NDIIO_API UNDIMediaReceiverBus : public UObject
+{
+	GENERATED_BODY()
+
+public:
+	/**
+		The receiver displaying the source on program, which is cut between the standby sources. It is initialized
+		by its owner, such as a receiver component, actor or media player.
+	*/
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Settings", META = (DisplayName = "Program Receiver"))
+	UNDIMediaReceiver* ProgramReceiver = nullptr;
+
+	/**
+		The sources kept connected in standby. The bandwidth of each source is the bandwidth it is received at once
+		it is on program.
+	*/
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Settings", META = (DisplayName = "Standby Sources"))
+	TArray<FNDIConnectionInformation> StandbySources;
+
+	/** The bandwidth the sources are received at while they are in standby */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Settings", META = (DisplayName = "Standby Bandwidth"))
+	ENDISourceBandwidth StandbyBandwidth = ENDISourceBandwidth::Lowest;
+
+private:
+	/** The cost of the standby connections, and the latency of the cuts */
+	UPROPERTY(BlueprintReadOnly, VisibleAnywhere, Category = "Information",
+			  META = (DisplayName = "Performance Data", AllowPrivateAccess = true))
+	FNDIReceiverBusPerformanceData PerformanceData;
+
+public:
+	/**
+		Connects the standby sources
+	*/
+	UFUNCTION(BlueprintCallable, Category = "NDI IO", META = (DisplayName = "Initialize"))
+	void Initialize();
+
+	/**
+		Changes the sources kept in standby. Sources which were already in standby keep their connection.
+	*/
+	UFUNCTION(BlueprintCallable, Category = "NDI IO", META = (DisplayName = "Change Standby Sources"))
+	void ChangeStandbySources(const TArray<FNDIConnectionInformation>& InStandbySources);
+
+	/**
+		Cuts the program receiver to the standby source at the given index. Returns false when the index is not
+		valid. A source whose standby connection is not established yet is connected as any other change of
+		connection would be.
+	*/
+	UFUNCTION(BlueprintCallable, Category = "NDI IO", META = (DisplayName = "Cut"))
+	bool Cut(int32 Index);
+
+	/**
+		Cuts the program receiver to the given source, from its standby connection if it is one of the standby
+		sources
+	*/
+	UFUNCTION(BlueprintCallable, Category = "NDI IO", META = (DisplayName = "Cut To Source"))
+	bool CutToSource(const FNDIConnectionInformation& InConnectionInformation);
+
+	/**
+		Disconnects the standby sources. The program receiver keeps its connection.
+	*/
+	UFUNCTION(BlueprintCallable, Category = "NDI IO", META = (DisplayName = "Shutdown"))
+	void Shutdown();
+
+	/**
+		Returns the current cost of the standby connections, and the latency of the last cut
+	*/
+	UFUNCTION(BlueprintCallable, Category = "NDI IO", META = (DisplayName = "Get Performance Data"))
+	FNDIReceiverBusPerformanceData GetPerformanceData();
+
+	/**
+	   Called before destroying the object.  This is called immediately upon deciding to destroy the object,
+	   to allow the object to begin an asynchronous cleanup process.
+	 */
+	virtual void BeginDestroy() override;
+
+private:
+	/**
+		A source connected in standby. It is shared with the worker thread establishing the connection, so that a
+		connection which completes after the source has been removed is destroyed by the worker itself.
+	*/
+	struct FStandbyConnection
+	{
+		FCriticalSection SyncContext;
+		uint32 Generation = 0;
+
+		FNDIConnectionInformation ConnectionInformation;
+
+		NDIlib_recv_instance_t p_receive_instance = nullptr;
+		NDIlib_framesync_instance_t p_framesync_instance = nullptr;
+	};
+
+	/** (Re-)connects a source in standby, on a worker thread */
+	void ConnectStandby(const TSharedRef<FStandbyConnection, ESPMode::ThreadSafe>& Standby);
+
+	/** Disconnects a source in standby */
+	void DisconnectStandby(const TSharedRef<FStandbyConnection, ESPMode::ThreadSafe>& Standby);
+
+	/** Returns whether both describe the same source, whatever the bandwidth they are received at */
+	static bool IsSameSource(const FNDIConnectionInformation& A, const FNDIConnectionInformation& B);
+
+private:
+	TArray<TSharedRef<FStandbyConnection, ESPMode::ThreadSafe>> StandbyConnections;
+};
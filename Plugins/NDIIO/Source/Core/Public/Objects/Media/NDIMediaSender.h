@@ -12,9 +12,16 @@
 #include <RendererInterface.h>
 #include <UObject/Object.h>
 #include <Misc/FrameRate.h>
+#include <Async/Future.h>
+#include <HAL/ThreadSafeBool.h>
 #include <Engine/TextureRenderTarget2D.h>
+#include <RenderCommandFence.h>
 #include <Structures/NDIBroadcastConfiguration.h>
+#include <Structures/NDISenderPerformanceData.h>
+#include <Structures/NDIMetadataBuilder.h>
+#include <Structures/NDISenderRegion.h>
 #include <Objects/Media/NDIMediaTexture2D.h>
+#include <Services/NDIConnectionService.h>
 #include <BaseMediaSource.h>
 
 #include <string>
@@ -76,6 +83,14 @@ private:
 			  META = (DisplayName="Output Alpha", AllowPrivateAccess = true))
 	bool OutputAlpha = false;
 
+	/**
+		Sends 16 bits P216 (PA16 with alpha) instead of 8 bits UYVY (UYVA), for high bit depth program feeds.
+		This doubles the amount of video data read back from the GPU and handed to the NDI encoder.
+	*/
+	UPROPERTY(BlueprintReadWrite, EditDefaultsOnly, Category = "Broadcast Settings",
+			  META = (DisplayName="Output 16-bit (P216/PA16)", AllowPrivateAccess = true))
+	bool bOutput16Bit = false;
+
 	UPROPERTY(BlueprintReadonly, VisibleAnywhere, Category = "Broadcast Settings",
 			  META = (DisplayName = "Alpha Remap Min", AllowPrivateAccess = true))
 	float AlphaMin = 0.f;
@@ -88,6 +103,69 @@ private:
 			  META = (DisplayName="Enable Audio", AllowPrivateAccess = true))
 	bool bEnableAudio = true;
 
+	/** Indicates the submix to send audio from (optional), when not set the main submix is used */
+	UPROPERTY(BlueprintReadWrite, EditDefaultsOnly, Category = "Broadcast Settings",
+			  META = (DisplayName="Audio Submix (optional)", AllowPrivateAccess = true))
+	USoundSubmix* AudioSubmix = nullptr;
+
+	/**
+		Publishes an additional low resolution, low frame rate stream of the same content under the name
+		"<Source Name> (Proxy)", for multiviewers. It is only converted and sent while it has receivers
+	*/
+	UPROPERTY(BlueprintReadWrite, EditDefaultsOnly, Category = "Broadcast Settings",
+			  META = (DisplayName="Enable Proxy Stream", AllowPrivateAccess = true))
+	bool bEnableProxyStream = false;
+
+	/** Describes the frame size of the proxy stream */
+	UPROPERTY(BlueprintReadWrite, EditDefaultsOnly, Category = "Broadcast Settings",
+			  META = (DisplayName="Proxy Frame Size", EditCondition = "bEnableProxyStream", AllowPrivateAccess = true))
+	FIntPoint ProxyFrameSize = FIntPoint(640, 360);
+
+	/** Represents the maximum number of frames (per second) sent on the proxy stream */
+	UPROPERTY(BlueprintReadWrite, EditDefaultsOnly, Category = "Broadcast Settings",
+			  META = (DisplayName="Proxy Frame Rate", EditCondition = "bEnableProxyStream", AllowPrivateAccess = true))
+	FFrameRate ProxyFrameRate = FFrameRate(15, 1);
+
+	/**
+		Rectangles of the input texture published as streams of their own, at the frame rate of the sender.
+		All regions are converted to UYVY in one pass into a shared texture, which is read back once,
+		and a region is only converted while its stream has receivers
+	*/
+	UPROPERTY(BlueprintReadWrite, EditDefaultsOnly, Category = "Broadcast Settings",
+			  META = (DisplayName="Output Regions", AllowPrivateAccess = true))
+	TArray<FNDISenderRegion> OutputRegions;
+
+	/**
+		Paces the sent frames with an output clock running at exactly the frame rate. The previous frame is repeated
+		at the end of an output frame the engine was too late for, and rendered frames are decimated when the engine
+		is early. Off by default, so that every rendered frame is sent as before
+	*/
+	UPROPERTY(BlueprintReadWrite, EditDefaultsOnly, Category = "Broadcast Settings",
+			  META = (DisplayName="Enable Frame Pacing", AllowPrivateAccess = true))
+	bool bEnableFramePacing = false;
+
+	/** The maximum number of times the previous frame is repeated, before output frames are skipped instead */
+	UPROPERTY(BlueprintReadWrite, EditDefaultsOnly, Category = "Broadcast Settings",
+			  META = (DisplayName="Max Repeated Frames", ClampMin = 0, EditCondition = "bEnableFramePacing", AllowPrivateAccess = true))
+	int32 MaxRepeatedFrames = 2;
+
+	/**
+		Computes a fingerprint of the content on the GPU each frame, and skips the conversion and readback of frames
+		identical to the last frame sent, which suits mostly static graphics such as lower thirds and score bugs.
+		The fingerprint is read back a frame late to avoid stalling on the GPU, so a change is sent one frame late
+	*/
+	UPROPERTY(BlueprintReadWrite, EditDefaultsOnly, Category = "Broadcast Settings",
+			  META = (DisplayName="Skip Unchanged Frames", AllowPrivateAccess = true))
+	bool bSkipUnchangedFrames = false;
+
+	/**
+		While the content is unchanged, the last frame is sent again at this rate so that receivers see a live stream,
+		and the other frames are dropped. Set it to the Frame Rate to send every frame
+	*/
+	UPROPERTY(BlueprintReadWrite, EditDefaultsOnly, Category = "Broadcast Settings",
+			  META = (DisplayName="Unchanged Frames Keep-Alive Rate", EditCondition = "bSkipUnchangedFrames", AllowPrivateAccess = true))
+	FFrameRate UnchangedFrameKeepAliveRate = FFrameRate(1, 1);
+
 	/** Sets whether or not to present PTZ capabilities */
 	UPROPERTY(BlueprintReadWrite, EditDefaultsOnly, Category = "Broadcast Settings", 
 			  META = (DisplayName="Enable PTZ", AllowPrivateAccess = true))
@@ -98,6 +176,21 @@ private:
 			  AdvancedDisplay, META = (DisplayName = "Render Target (optional)", AllowPrivateAccess = true))
 	UTextureRenderTarget2D* RenderTarget = nullptr;
 
+	/**
+		Indicates a texture to send over NDI instead of the Render Target (optional), such as a media texture or
+		a Composure output. The color conversion reads straight from it, without copying it to a render target
+	*/
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Content",
+			  AdvancedDisplay, META = (DisplayName = "Input Texture (optional)", AllowPrivateAccess = true))
+	UTexture* InputTexture = nullptr;
+
+	/**
+		Information about the cadence of the sent frames
+	*/
+	UPROPERTY(BlueprintReadOnly, VisibleAnywhere, Category = "Information",
+			  META = (DisplayName = "Performance Data", AllowPrivateAccess = true))
+	FNDISenderPerformanceData PerformanceData;
+
 	/**
 		Should perform the Linear to sRGB color space conversion
 	*/
@@ -167,11 +260,99 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "NDI IO", META = (DisplayName = "Send Metadata To Receivers (Element + Attributes)"))
 	void SendMetadataFrameAttrs(const FString& Element, const TMap<FString,FString>& Attributes, bool AttachToVideoFrame = true);
 
+	/**
+		This will send metadata already composed as UTF-8 to all receivers, without any intermediate strings
+		The data is expected to be valid XML
+	*/
+	void SendMetadataFrameUTF8(const FNDIMetadataBuilder& Data, bool AttachToVideoFrame = true);
+
+	/**
+		Sends a video frame from CPU memory, converting it to UYVY (UYVA with alpha) on the CPU, so that frames can
+		be sent without a GPU, for instance by server builds or processes running with -nullrhi.
+		Supports PF_B8G8R8A8 and PF_FloatRGBA pixels; the width must be even and the frame is sent without scaling.
+		The colour conversion is vectorized; PF_FloatRGBA pixels are first quantized to 8 bits through lookup tables,
+		one pixel at a time, so they convert more slowly than PF_B8G8R8A8 pixels.
+		Frames should either be sent through this function or from a Render Target, not both.
+
+		@param Data - The first pixel of the frame
+		@param PixelFormat - The format of the pixels, PF_B8G8R8A8 or PF_FloatRGBA
+		@param Size - The size of the frame in pixels
+		@param StrideInBytes - The number of bytes from one line to the next, or 0 for tightly packed lines
+		@param Timecode - The timecode of the frame (in 100ns units), or 0 to have the NDI SDK synthesize it
+		@return Whether the frame was sent
+	*/
+	bool SendVideoFrameFromCPU(const uint8* Data, EPixelFormat PixelFormat, FIntPoint Size, int32 StrideInBytes = 0, int64 Timecode = 0);
+
+	/**
+		Waits until the last frame sent with SendVideoFrameFromCPU has been consumed by the NDI SDK
+	*/
+	void WaitForVideoFrameFromCPU();
+
+	/**
+		Sends interleaved audio from CPU memory, instead of the audio of the submix the sender is routed to.
+		Once audio has been sent this way, the audio of the submix is no longer sent, until StopSendingAudioFromCPU
+		is called or the sender is shut down.
+
+		@param Data - The first sample of the audio, with the channels interleaved
+		@param NumSamples - The number of samples per channel
+		@param NumChannels - The number of channels
+		@param SampleRate - The sample rate of the audio
+		@param Timecode - The timecode of the first sample (in 100ns units), or 0 to have the NDI SDK synthesize it
+		@return Whether the audio was sent
+	*/
+	bool SendAudioFrameFromCPU(const float* Data, int32 NumSamples, int32 NumChannels, int32 SampleRate, int64 Timecode = 0);
+
+	/**
+		Resumes sending the audio of the submix the sender is routed to, after audio has been sent from CPU memory
+	*/
+	void StopSendingAudioFromCPU();
+
+	/**
+		Changes the rectangles of the Render Target published as streams of their own
+	*/
+	UFUNCTION(BlueprintCallable, Category = "NDI IO", META = (DisplayName = "Change Output Regions"))
+	void ChangeOutputRegions(const TArray<FNDISenderRegion>& InOutputRegions);
+
 	/**
 		Attempts to change the RenderTarget used in sending video frames over NDI
 	*/
 	void ChangeVideoTexture(UTextureRenderTarget2D* VideoTexture = nullptr);
 
+	/**
+		Changes the texture sent over NDI to any texture, instead of the Render Target
+	*/
+	UFUNCTION(BlueprintCallable, Category = "NDI IO", META = (DisplayName = "Change Input Texture"))
+	void ChangeInputTexture(UTexture* Texture = nullptr);
+
+	/**
+		Changes the texture sent over NDI to an RHI texture of any format, including sRGB and HDR float formats,
+		which takes precedence over the Input Texture and the Render Target. Textures produced by render graph
+		passes can be sent once extracted, for instance with FRDGBuilder::QueueTextureExtraction.
+		The sender holds a reference to the texture until this is called again with nullptr.
+	*/
+	void ChangeInputTextureRHI(FRHITexture* Texture);
+
+	/**
+		Adds a stream converted from a texture other than the input, such as the back buffer of another window,
+		or changes its frame size. Texture streams are converted in the same pass as the output regions, into the
+		same readback, and are sent at the frame rate of the sender while they have receivers. The whole texture
+		is scaled to the frame size of the stream.
+	*/
+	void ChangeTextureStream(const void* StreamKey, const FString& StreamName, FIntPoint StreamFrameSize);
+	void RemoveTextureStream(const void* StreamKey);
+
+	/**
+		Changes the texture a texture stream is converted from, and releases the textures of every texture stream.
+		The sender holds a reference to the texture until it is released.
+	*/
+	void ChangeTextureStreamInputRHI(const void* StreamKey, const FTexture2DRHIRef& Texture);
+	void ReleaseTextureStreamInputs();
+
+	/**
+		Attempts to change the submix used in sending audio frames over NDI
+	*/
+	void ChangeAudioSubmix(USoundSubmix* Submix = nullptr);
+
 	/**
 		Change the alpha remapping settings
 	*/
@@ -205,6 +386,12 @@ public:
 	 */
 	virtual void BeginDestroy() override;
 
+	/**
+		Called to check whether the object is ready to be destroyed, once the render commands releasing the streams
+		of the output regions have run
+	*/
+	virtual bool IsReadyForFinishDestroy() override;
+
 	/**
 		Set whether or not a RGB to Linear conversion is made
 	*/
@@ -230,9 +417,42 @@ public:
 		return this->FrameRate;
 	}
 
+	/**
+		Returns the current frame pacing performance data of the sender
+	*/
+	const FNDISenderPerformanceData& GetPerformanceData() const;
+
+	/**
+		Returns the number of bytes in one video frame handed to the NDI encoder for the current output format.
+		For a 1920x1080 frame this is 4147200 for UYVY, 6220800 for UYVA, 8294400 for P216 and 12441600 for PA16
+	*/
+	int32 GetVideoFrameSizeInBytes() const;
+
+	/**
+		CPU reference of the P216/PA16 conversion performed on the GPU, for verifying the GPU output.
+		Source holds Size.X * Size.Y pixels (Size.X even) already in the output color space, without scaling;
+		OutData receives the luma plane, the interleaved CbCr plane and, with alpha, the alpha plane
+	*/
+	static void ConvertToP216Reference(const TArray<FLinearColor>& Source, FIntPoint Size, bool bWithAlpha,
+	                                   FVector2D AlphaMinMax, TArray<uint16>& OutData);
+
 private:
 
 	bool CreateSender();
+	bool CreateProxySender();
+
+	FString GetProxySourceName() const;
+
+	/**
+		Creates the senders of the output regions. They replace the current ones on the render thread, where the
+		regions are laid out in the shared conversion texture.
+	*/
+	void CreateRegionSenders();
+	void DestroyRegionSenders();
+	NDIlib_send_instance_t CreateRegionSendInstance(const FString& StreamName);
+	void FlushRegionStreams(FRHICommandListImmediate& RHICmdList);
+	void ConfigureRegions(FRHICommandListImmediate& RHICmdList);
+	FString GetRegionSourceName(int32 RegionIndex) const;
 
 	/**
 		Attempts to get a metadata frame from the sender.
@@ -245,7 +465,7 @@ private:
 		This will attempt to generate an audio frame, add the frame to the stack and return immediately,
 		having scheduled the frame asynchronously.
 	*/
-	void TrySendAudioFrame(int64 time_code, float* AudioData, int32 NumSamples, int32 NumChannels, const int32 SampleRate, double AudioClock);
+	void TrySendAudioFrame(const FNDISubmixAudioFramePtr& AudioFrame);
 
 	/**
 		This will attempt to generate a video frame, add the frame to the stack and return immediately,
@@ -253,11 +473,61 @@ private:
 	*/
 	void TrySendVideoFrame(int64 time_code = 0);
 
+	/**
+		Converts and sends a frame of the proxy stream, if it has receivers and a new proxy frame is due.
+		Called from TrySendVideoFrame only, with the render lock held.
+	*/
+	void TrySendProxyVideoFrame(int64 time_code);
+	bool DrawProxyRenderTarget(FRHICommandListImmediate& RHICmdList);
+
+	/**
+		Converts the output regions which have receivers, and sends a frame on each of their streams.
+		Called from TrySendVideoFrame only, with the render lock held.
+	*/
+	void TrySendRegionVideoFrames(int64 time_code);
+	bool DrawRegionRenderTarget(FRHICommandListImmediate& RHICmdList);
+
+	/**
+		Frame pacing scheduler, running an output clock at exactly FrameRate
+	*/
+	bool SchedulePacedFrame(int64 time_code, uint64 NowCycles, int64& OutSlot);
+	int64 GetPacingSlot(uint64 NowCycles) const;
+	uint64 GetPacingSlotStartCycles(int64 Slot) const;
+	int64 GetPacedTimecode(int64 Slot) const;
+	void ClaimPacedSlot(int64 Slot);
+	void CompletePacedFrame(int64 Slot, uint64 NowCycles);
+	void ResetFramePacing();
+
+	/**
+		Worker repeating the previous frame at the end of each output frame the engine was too late for, so that
+		repeated frames are sent at the output cadence rather than in a burst with the next rendered frame
+	*/
+	void StartPacingThread();
+	void StopPacingThread();
+	void RunPacingThread();
+	void SendPacedRepeat(uint64 NowCycles);
+
 	/**
 		Perform the color conversion (if any) and bit copy from the gpu
 	*/
 	bool DrawRenderTarget(FRHICommandListImmediate& RHICmdList);
 
+	/**
+		Computes the fingerprint of the input texture on the GPU, and returns whether the fingerprint of the
+		previous frame matches the last frame sent
+	*/
+	bool IsInputUnchanged(FRHICommandListImmediate& RHICmdList);
+
+	/**
+		Records that the frame fingerprinted last has been sent, so that its fingerprint becomes the reference
+	*/
+	void CommitFingerprint();
+
+	/**
+		Sends the last frame again if the keep-alive rate requires it, instead of an unchanged frame
+	*/
+	void SendUnchangedFrame(uint64 NowCycles, int64 OutputSlot);
+
 	/**
 		Change the render target configuration based on the passed in parameters
 
@@ -277,21 +547,50 @@ private:
 
 	FTextureResource* GetRenderTargetResource() const;
 
+	/**
+		Returns the texture to convert and send: the RHI input texture, else the Input Texture, else the Render Target
+	*/
+	FTexture2DRHIRef GetInputTextureRHI() const;
+
 private:
 	std::atomic<bool> bIsChangingBroadcastSize { false };
 
 	FTimecode LastRenderTime;
 
+	bool bIsPacingClockRunning = false;
+	uint64 PacingClockStartCycles = 0;
+	int64 PacingTimecodeBase = 0;
+	int64 PacingLastSlot = -1;
+	int64 PacingLastSendSlot = -1;
+	uint64 PacingLastSendCycles = 0;
+	int32 PacingRepeatCount = 0;
+	int64 PacingCadenceSamples = 0;
+
+	FThreadSafeBool bIsPacingThreadRunning;
+	FEvent* PacingWakeEvent = nullptr;
+	TFuture<void> PacingThread;
+
 	FTexture2DRHIRef DefaultVideoTextureRHI;
 
-	TArray<float> SendAudioData;
+	FTextureRHIRef InputTextureRHI;
+
+	/** The submix this sender is currently registered to listen to */
+	USoundSubmix* ListenedAudioSubmix = nullptr;
+	bool bIsSendingAudioFromCPU = false;
 
 	NDIlib_video_frame_v2_t NDI_video_frame;
 	NDIlib_send_instance_t p_send_instance = nullptr;
 
+	NDIlib_video_frame_v2_t NDI_proxy_video_frame;
+	NDIlib_send_instance_t p_proxy_send_instance = nullptr;
+	int64 LastProxySlot = -1;
+
 	FCriticalSection AudioSyncContext;
 	FCriticalSection RenderSyncContext;
 
+	/** The thread sending the video frames while it holds the render lock, for the send helpers to check it */
+	uint32 RenderSendThreadId = 0;
+
 	/**
 		A texture with CPU readback
 	*/
@@ -300,12 +599,12 @@ private:
 	private:
 		FTexture2DRHIRef Texture = nullptr;
 		void* pData = nullptr;
-		std::string MetaData;
+		FNDIMetadataBuilder MetaData;
 
 	public:
 		~MappedTexture();
 
-		void Create(FIntPoint FrameSize);
+		void Create(FIntPoint FrameSize, EPixelFormat PixelFormat = PF_B8G8R8A8);
 		void Destroy();
 
 		FIntPoint GetSizeXY() const;
@@ -314,10 +613,12 @@ private:
 
 		void Map(FRHICommandListImmediate& RHICmdList, int32& OutWidth, int32& OutHeight);
 		void* MappedData() const;
+		bool IsMapped() const;
 		void Unmap(FRHICommandListImmediate& RHICmdList);
 
-		void AddMetaData(const FString& Data);
-		const std::string& GetMetaData() const;
+		void AddMetaData(const FNDIMetadataBuilder& Data);
+		const FNDIMetadataBuilder& GetMetaData() const;
+		void MoveMetaData(FNDIMetadataBuilder& OutMetaData);
 	};
 
 	/**
@@ -334,7 +635,7 @@ private:
 		int32 CurrentIndex = 0;
 
 	public:
-		void Create(FIntPoint FrameSize);
+		void Create(FIntPoint FrameSize, EPixelFormat PixelFormat = PF_B8G8R8A8);
 		void Destroy();
 
 		FIntPoint GetSizeXY() const;
@@ -343,12 +644,97 @@ private:
 
 		void Map(FRHICommandListImmediate& RHICmdList, int32& OutWidth, int32& OutHeight);
 		void Send(FRHICommandListImmediate& RHICmdList, NDIlib_send_instance_t p_send_instance, NDIlib_video_frame_v2_t& p_video_data);
+		bool Resend(NDIlib_send_instance_t p_send_instance, NDIlib_video_frame_v2_t& p_video_data);
 		void Flush(FRHICommandListImmediate& RHICmdList, NDIlib_send_instance_t p_send_instance);
 
-		void AddMetaData(const FString& Data);
+		void AddMetaData(const FNDIMetadataBuilder& Data);
+		void MoveMetaData(FNDIMetadataBuilder& OutMetaData);
+		bool HasMetaData() const;
+
+		const uint8* GetMappedData() const;
+		void Advance(FRHICommandListImmediate& RHICmdList);
+		void Unmap(FRHICommandListImmediate& RHICmdList);
+	};
+
+	/**
+		Class for managing the asynchronous sending of video frames converted on the CPU, double-buffered
+		in the same way as MappedTextureASyncSender
+	*/
+	class CPUFrameASyncSender
+	{
+	private:
+		TArray<uint8> Buffers[2];
+		FNDIMetadataBuilder MetaData[2];
+		int32 CurrentIndex = 0;
+
+	public:
+		uint8* GetBuffer(int32 SizeInBytes);
+		FNDIMetadataBuilder& GetMetaData();
+
+		void Send(NDIlib_send_instance_t p_send_instance, NDIlib_video_frame_v2_t& p_video_data);
+		void Flush(NDIlib_send_instance_t p_send_instance);
+		void Destroy();
 	};
 
 	MappedTextureASyncSender ReadbackTextures;
 	bool ReadbackTexturesHaveAlpha = false;
+	bool ReadbackTexturesAre16Bit = false;
 	FPooledRenderTargetDesc RenderTargetDescriptor;
+
+	MappedTextureASyncSender ProxyReadbackTextures;
+	FPooledRenderTargetDesc ProxyRenderTargetDescriptor;
+	/** The size the proxy stream is sent at: the Proxy Frame Size clamped to the main stream, which is left as set */
+	FIntPoint EffectiveProxyFrameSize = FIntPoint(640, 360);
+
+	/**
+		The stream of an output region, and where the region is drawn in the shared conversion texture
+	*/
+	struct FRegionOutput
+	{
+		/** Set for the texture streams, which are converted from InputTexture rather than the input */
+		const void* StreamKey = nullptr;
+		FTexture2DRHIRef InputTexture;
+		FNDISenderRegion Region;
+		NDIlib_send_instance_t p_send_instance = nullptr;
+		NDIlib_video_frame_v2_t VideoFrame;
+		FIntRect SourceRect;
+		int32 TextureLine = 0;
+		bool bIsInsideSource = false;
+		bool bIsDrawn = false;
+		bool bHasPendingFrame = false;
+	};
+
+	/**
+		Flushes and destroys the current streams of the output regions on the render thread, and replaces them
+	*/
+	void ReplaceRegionOutputs(TArray<FRegionOutput>&& NewRegionOutputs);
+
+	TArray<FRegionOutput> RegionOutputs;
+	TMap<const void*, FNDISenderRegion> TextureStreams;
+	MappedTextureASyncSender RegionReadbackTextures;
+	FPooledRenderTargetDesc RegionRenderTargetDescriptor;
+	int64 LastRegionSlot = -1;
+	FIntPoint RegionSourceSize = FIntPoint::ZeroValue;
+	FRenderCommandFence RegionReleaseFence;
+
+	/**
+		A fingerprint being read back, which is mapped with the next frame fingerprinted
+	*/
+	struct FFingerprintReadback
+	{
+		MappedTexture Texture;
+		bool bIsPending = false;
+		bool bWasSent = false;
+	};
+
+	static constexpr int32 FingerprintSize = 64;
+	FFingerprintReadback FingerprintReadbacks[2];
+	int32 FingerprintIndex = 0;
+	FPooledRenderTargetDesc FingerprintRenderTargetDescriptor;
+	TArray<uint32> LastFingerprint;
+	uint64 LastVideoSendCycles = 0;
+
+	NDIlib_video_frame_v2_t NDI_cpu_video_frame;
+	CPUFrameASyncSender CPUVideoFrames;
+	TArray<FColor> CPUConversionLine;
 };
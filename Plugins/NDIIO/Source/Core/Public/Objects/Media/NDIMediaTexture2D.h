@@ -47,6 +47,9 @@ public:
 private:
 	virtual class FTextureResource* CreateResource() override;
 
+	/** Points the texture at the given texture, or at the shared placeholder when given none; on the render thread */
+	void SetTextureReference_RenderThread(FRHITexture* Texture);
+
 	void SetMyResource(FTextureResource* ResourceIn);
 	FTextureResource* GetMyResource();
 	const FTextureResource* GetMyResource() const;
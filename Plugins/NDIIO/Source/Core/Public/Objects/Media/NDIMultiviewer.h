@@ -0,0 +1,186 @@
+/*
+	Copyright (C) 2023 Vizrt NDI AB. All rights reserved.
+
+	This file and it's use within a Product is bound by the terms of NDI SDK license that was provided
+	as part of the NDI SDK. For more information, please review the license and the NDI SDK documentation.
+*/
+
+#pragma once
+
+#include <NDIIOPluginAPI.h>
+
+#include <UObject/Object.h>
+#include <Engine/TextureRenderTarget2D.h>
+#include <RenderCommandFence.h>
+
+#include <Objects/Media/NDIMediaReceiver.h>
+#include <Objects/Media/NDIMediaSender.h>
+#include <Structures/NDIMultiviewerTile.h>
+
+#include "NDIMultiviewer.generated.h"
+
+/**
+	Composes many sources into a single render target, the way a multiviewer does. The frames of all the sources are
+	uploaded into one atlas, then converted and composed with their labels, tally borders and audio meters in a
+	single pass, rather than each source having its own render target, conversion pass and material.
+*/
+UCLASS(BlueprintType, Blueprintable, Category = "NDI IO", HideCategories = ("Information"),
+	   META = (DisplayName = "NDI Multiviewer"))
+class NDIIO_API UNDIMultiviewer : public UObject
+{
+	GENERATED_BODY()
+
+public:
+	/**
+		The tiles of the multiviewer, in reading order, up to 64. Sources received at the lowest bandwidth keep the
+		cost of many tiles down.
+	*/
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Settings", META = (DisplayName = "Tiles"))
+	TArray<FNDIMultiviewerTile> Tiles;
+
+	/** The number of columns of tiles, or 0 to lay the tiles out in a square grid */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Settings", META = (DisplayName = "Columns", ClampMin = 0))
+	int32 Columns = 0;
+
+	/** The size of the render target created when no output target is given */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Settings", META = (DisplayName = "Output Size"))
+	FIntPoint OutputSize = FIntPoint(1920, 1080);
+
+	/** The render target the tiles are composed into, created when none is given */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Settings", META = (DisplayName = "Output Target"))
+	UTextureRenderTarget2D* OutputTarget = nullptr;
+
+	/** An optional sender, sending the composed tiles over NDI */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Settings", META = (DisplayName = "Sender"))
+	UNDIMediaSender* Sender = nullptr;
+
+	/** The width, in pixels, of the border around each tile */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Settings", META = (DisplayName = "Border Width", ClampMin = 0))
+	int32 BorderWidth = 3;
+
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Settings", META = (DisplayName = "Border Color"))
+	FLinearColor BorderColor = FLinearColor(0.05f, 0.05f, 0.05f, 1.f);
+
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Settings", META = (DisplayName = "Preview Color"))
+	FLinearColor PreviewColor = FLinearColor(0.f, 0.8f, 0.f, 1.f);
+
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Settings", META = (DisplayName = "Program Color"))
+	FLinearColor ProgramColor = FLinearColor(0.9f, 0.f, 0.f, 1.f);
+
+	/** The width, in pixels, of each of the two audio meters of a tile, or 0 to hide the meters */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Settings", META = (DisplayName = "Audio Meter Width", ClampMin = 0))
+	int32 AudioMeterWidth = 6;
+
+private:
+	/** The time, in milliseconds, the render thread spent capturing, uploading and composing the last frame */
+	UPROPERTY(BlueprintReadOnly, VisibleAnywhere, Category = "Information",
+			  META = (DisplayName = "Render Thread Time", AllowPrivateAccess = true))
+	float RenderThreadTime = 0.f;
+
+	/** The number of frames uploaded into the atlas for the last frame */
+	UPROPERTY(BlueprintReadOnly, VisibleAnywhere, Category = "Information",
+			  META = (DisplayName = "Uploaded Frames", AllowPrivateAccess = true))
+	int32 UploadedFrames = 0;
+
+public:
+	/**
+		Connects the sources of the tiles and starts composing them into the output target
+	*/
+	UFUNCTION(BlueprintCallable, Category = "NDI IO", META = (DisplayName = "Initialize"))
+	void Initialize();
+
+	/**
+		Changes the tiles of the multiviewer. Sources which were already shown keep their connection. Tiles past the
+		first 64 are dropped.
+	*/
+	UFUNCTION(BlueprintCallable, Category = "NDI IO", META = (DisplayName = "Change Tiles"))
+	void ChangeTiles(const TArray<FNDIMultiviewerTile>& InTiles);
+
+	/**
+		Changes the tally of the tile at the given index
+	*/
+	UFUNCTION(BlueprintCallable, Category = "NDI IO", META = (DisplayName = "Change Tally"))
+	void ChangeTally(int32 Index, ENDITallyState InTally);
+
+	/**
+		Stops composing the tiles and disconnects their sources
+	*/
+	UFUNCTION(BlueprintCallable, Category = "NDI IO", META = (DisplayName = "Shutdown"))
+	void Shutdown();
+
+	/** Returns the render target the tiles are composed into */
+	UFUNCTION(BlueprintCallable, Category = "NDI IO", META = (DisplayName = "Get Output Target"))
+	UTextureRenderTarget2D* GetOutputTarget() const;
+
+	/** Returns the time, in milliseconds, the render thread spent on the last frame */
+	UFUNCTION(BlueprintCallable, Category = "NDI IO", META = (DisplayName = "Get Render Thread Time"))
+	float GetRenderThreadTime() const;
+
+	/**
+	   Called before destroying the object.  This is called immediately upon deciding to destroy the object,
+	   to allow the object to begin an asynchronous cleanup process.
+	 */
+	virtual void BeginDestroy() override;
+
+	/**
+		Called to check whether the object is ready to be destroyed, once the render thread has stopped composing
+		the tiles and released them
+	*/
+	virtual bool IsReadyForFinishDestroy() override;
+
+private:
+	/** Draws the labels of the tiles, one row per tile, into the label target */
+	void DrawLabels();
+
+	/** Sends the layout and the tally colours of the tiles to the render thread */
+	void UpdateRenderTiles();
+
+	/** Captures the frames of the sources, and composes the tiles; on the render thread */
+	void RenderTiles_RenderThread(FRHICommandListImmediate& RHICmdList);
+
+	/** Uploads the frame of a tile into its slot of the atlas; on the render thread */
+	void OnVideoCaptured_RenderThread(UNDIMediaReceiver* Receiver, const NDIlib_video_frame_v2_t& video_frame);
+
+	/** Measures the peak levels of the audio of a tile; on the render thread */
+	void OnAudioCaptured_RenderThread(UNDIMediaReceiver* Receiver, const NDIlib_audio_frame_v2_t& audio_frame);
+
+	FTextureResource* GetOutputTargetResource() const;
+	FTextureResource* GetLabelTargetResource() const;
+
+private:
+	/** The receivers of the sources of the tiles, controlled by the multiviewer */
+	UPROPERTY(Transient)
+	TArray<UNDIMediaReceiver*> Receivers;
+
+	/** Receivers no longer shown, kept until the render thread has stopped using them */
+	UPROPERTY(Transient)
+	TArray<UNDIMediaReceiver*> RetiredReceivers;
+	FRenderCommandFence RetiredReceiversFence;
+
+	UPROPERTY(Transient)
+	UTextureRenderTarget2D* LabelTarget = nullptr;
+
+	/** The size of the label of a tile in the label target */
+	static constexpr int32 LabelWidth = 384;
+	static constexpr int32 LabelHeight = 28;
+
+	/** The state of a tile, as seen by the render thread */
+	struct FRenderTile
+	{
+		UNDIMediaReceiver* Receiver = nullptr;
+		FLinearColor BorderColor = FLinearColor::Black;
+		FIntPoint SourceSize = FIntPoint(0, 0);
+		FVector2D AudioLevels = FVector2D(0, 0);
+		FVector2D AudioPeaks = FVector2D(0, 0);
+	};
+	TArray<FRenderTile> RenderTiles;
+	int32 RenderColumns = 1;
+	int32 RenderRows = 1;
+
+	/** The atlas of the UYVY frames of the tiles, with a slot of the largest source size per tile */
+	FTexture2DRHIRef AtlasTexture;
+	FIntPoint AtlasSlotSize = FIntPoint(0, 0);
+	int32 UploadedFrames_RenderThread = 0;
+
+	FDelegateHandle FrameEndRTHandle;
+};
@@ -0,0 +1,142 @@
+/*
+	Copyright (C) 2023 Vizrt NDI AB. All rights reserved.
+
+	This file and it's use within a Product is bound by the terms of NDI SDK license that was provided
+	as part of the NDI SDK. For more information, please review the license and the NDI SDK documentation.
+*/
+
+#pragma once
+
+#include <NDIIOPluginAPI.h>
+
+#include <UObject/Object.h>
+#include <RenderCommandFence.h>
+
+#include <Objects/Media/NDIMediaReceiver.h>
+#include <Structures/NDIConnectionInformation.h>
+#include <Structures/NDIReceiverSyncGroupPerformanceData.h>
+#include <Structures/NDIVideoFrame.h>
+
+#include "NDIReceiverSyncGroup.generated.h"
+
+/**
+	Receives a group of sources sent from the same timebase, such as the cameras of a multi-camera rig, and releases
+	their frames in sets whose frames were all sent at the same time. The frames of every member are buffered until
+	a frame of every other member has arrived within the tolerance of it, and each matched set is displayed on the
+	video textures of the members in the same render thread frame, so that they are never seen out of step.
+*/
+UCLASS(BlueprintType, Blueprintable, Category = "NDI IO", HideCategories = ("Information"),
+	   META = (DisplayName = "NDI Receiver Sync Group"))
+class NDIIO_API UNDIReceiverSyncGroup : public UObject
+{
+	GENERATED_BODY()
+
+public:
+	/** The sources of the members of the group */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Settings", META = (DisplayName = "Sources"))
+	TArray<FNDIConnectionInformation> Sources;
+
+	/**
+		Whether to match the frames by the timecode given to them by their sender, rather than the time they were sent
+		at. Timecodes only match when the senders share a timecode source, but then do so even when their clocks do not.
+	*/
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Settings", META = (DisplayName = "Match Timecodes"))
+	bool bMatchTimecodes = false;
+
+	/** The time, in milliseconds, by which the frames of a set may differ and still be matched */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Settings", META = (DisplayName = "Tolerance", ClampMin = 0.0))
+	float Tolerance = 5.f;
+
+	/**
+		The number of frames buffered per member while waiting for the other members. The oldest frame of a member is
+		dropped once its buffer is full, which bounds the memory held when a member stops sending.
+	*/
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Settings", META = (DisplayName = "Max Buffered Frames", ClampMin = 1))
+	int32 MaxBufferedFrames = 4;
+
+private:
+	/** How well the frames of the members are being matched */
+	UPROPERTY(BlueprintReadOnly, VisibleAnywhere, Category = "Information",
+			  META = (DisplayName = "Performance Data", AllowPrivateAccess = true))
+	FNDIReceiverSyncGroupPerformanceData PerformanceData;
+
+public:
+	/**
+		Broadcast on the render thread with each matched set of frames, in the order of the sources
+	*/
+	DECLARE_EVENT_TwoParams(FNDIReceiverSyncGroupFramesEvent, FOnSyncGroupFramesEvent,
+	                        UNDIReceiverSyncGroup*, const TArray<FNDIVideoFrameRef>&) FOnSyncGroupFramesEvent OnNDISyncGroupFramesEvent;
+
+public:
+	/**
+		Connects the sources of the members and starts matching their frames
+	*/
+	UFUNCTION(BlueprintCallable, Category = "NDI IO", META = (DisplayName = "Initialize"))
+	void Initialize();
+
+	/**
+		Stops matching the frames and disconnects the sources of the members
+	*/
+	UFUNCTION(BlueprintCallable, Category = "NDI IO", META = (DisplayName = "Shutdown"))
+	void Shutdown();
+
+	/**
+		Returns the receivers of the members, in the order of the sources. Their video textures show the frames of the
+		last matched set.
+	*/
+	UFUNCTION(BlueprintCallable, Category = "NDI IO", META = (DisplayName = "Get Receivers"))
+	const TArray<UNDIMediaReceiver*>& GetReceivers() const;
+
+	/**
+		Returns the number of sets matched, and of frames dropped, since the group was initialized
+	*/
+	UFUNCTION(BlueprintCallable, Category = "NDI IO", META = (DisplayName = "Get Performance Data"))
+	const FNDIReceiverSyncGroupPerformanceData& GetPerformanceData() const;
+
+	/**
+	   Called before destroying the object.  This is called immediately upon deciding to destroy the object,
+	   to allow the object to begin an asynchronous cleanup process.
+	 */
+	virtual void BeginDestroy() override;
+
+	/**
+		Called to check whether the object is ready to be destroyed, once the render thread has stopped matching the
+		frames of the members and released them
+	*/
+	virtual bool IsReadyForFinishDestroy() override;
+
+private:
+	/** Captures the frames of the members, and releases the sets matched; on the render thread */
+	void MatchFrames_RenderThread();
+
+	/** Buffers the frame of a member until it is matched; on the render thread */
+	void OnVideoFrame_RenderThread(UNDIMediaReceiver* Receiver, const FNDIVideoFrameRef& Frame);
+
+	/** Returns the time, in 100ns intervals, the frames are matched by; on the render thread */
+	int64 GetMatchTime(const FNDIVideoFrame& Frame) const;
+
+private:
+	/** The receivers of the members, controlled by the group */
+	UPROPERTY(Transient)
+	TArray<UNDIMediaReceiver*> Receivers;
+
+	/** Receivers of a previous initialization, kept until the render thread has stopped using them */
+	UPROPERTY(Transient)
+	TArray<UNDIMediaReceiver*> RetiredReceivers;
+	FRenderCommandFence RetiredReceiversFence;
+
+	/** The state of a member, as seen by the render thread */
+	struct FRenderMember
+	{
+		UNDIMediaReceiver* Receiver = nullptr;
+		TArray<FNDIVideoFrameRef> Frames;
+	};
+	TArray<FRenderMember> RenderMembers;
+
+	/** The settings of the group, as seen by the render thread */
+	int64 RenderTolerance = 0;
+	int32 RenderMaxBufferedFrames = 1;
+	bool bRenderMatchTimecodes = false;
+
+	FDelegateHandle FrameEndRTHandle;
+};
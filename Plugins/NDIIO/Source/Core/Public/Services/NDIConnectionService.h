@@ -15,9 +15,38 @@
 #include <ISubmixBufferListener.h>
 #endif
 #include <Widgets/SWindow.h>
+#include <Misc/FrameRate.h>
+#include <Enumerations/NDITimecodeSource.h>
+
+class USoundSubmix;
+
+/**
+	A block of submix audio which has been deinterleaved once by the connection service, and which is
+	shared by every sender that is routed to the same submix
+*/
+struct NDIIO_API FNDISubmixAudioFrame
+{
+	/** The submix which produced this audio */
+	const USoundSubmix* Submix = nullptr;
+
+	/** Whether the submix is the main (master) submix of the audio device */
+	bool bIsMainSubmix = false;
+
+	int64 Timecode = 0;
+	int32 NumSamples = 0;		// Samples per channel
+	int32 NumChannels = 0;
+	int32 SampleRate = 0;
+	double AudioClock = 0.0;
+
+	/** Planar audio data, with each channel 'ChannelStrideInBytes' apart */
+	TArray<float> PlanarData;
+	int32 ChannelStrideInBytes = 0;
+};
+
+typedef TSharedPtr<FNDISubmixAudioFrame, ESPMode::ThreadSafe> FNDISubmixAudioFramePtr;
 
 DECLARE_EVENT_OneParam(FNDICoreDelegates, FNDIConnectionServiceSendVideoEvent, int64)
-DECLARE_EVENT_SixParams(FNDICoreDelegates, FNDIConnectionServiceSendAudioEvent, int64, float*, int32, int32, const int32, double)
+DECLARE_EVENT_OneParam(FNDICoreDelegates, FNDIConnectionServiceSendAudioEvent, const FNDISubmixAudioFramePtr&)
 
 /**
 	A service which runs and triggers updates for interested parties to be notified of
@@ -49,6 +78,13 @@ public:
 		return bIsInPIEMode;
 	}
 
+	/**
+		Requests audio from a submix other than the main submix to be delivered through 'EventOnSendAudioFrame'.
+		Each call must be balanced by a call to 'RemoveSubmixListener'.
+	*/
+	static void AddSubmixListener(USoundSubmix* Submix);
+	static void RemoveSubmixListener(USoundSubmix* Submix);
+
 private:
 	// Handler for when the render thread frame has ended
 	void OnEndRenderFrame();
@@ -61,7 +97,25 @@ private:
 	// Handler for when the back buffer is read to present to the end user
 	void OnActiveViewportBackbufferReadyToPresent(SWindow& Window, const FTexture2DRHIRef& Backbuffer);
 
-	FTextureResource* GetVideoTextureResource() const;
+	// Handler for when the game thread frame has ended
+	void OnEndFrame();
+
+	bool IsActiveViewportWindow(const SWindow& Window) const;
+
+	// Adds a stream of the active viewport sender for each window which has none, and removes those of the windows
+	// which are gone
+	void UpdateWindowOutputs();
+	FString GetUniqueWindowStreamName(const SWindow& Window) const;
+	void DestroyWindowOutputs();
+
+	void RegisterSubmixListeners();
+	void UnregisterSubmixListeners();
+
+	// Returns the timecodes of the frames sent, from the clock selected in the plugin settings
+	int64 GetVideoTimecode();
+	int64 GetAudioTimecode(const USoundSubmix* Submix, int32 NumSamples, int32 SampleRate, double AudioClock);
+	void StartMediaClock(int64 TimeOfDay);
+	double GetMediaClockSeconds() const;
 
 	virtual void OnNewSubmixBuffer(const USoundSubmix* OwningSubmix, float* AudioData, int32 NumSamples, int32 NumChannels, const int32 SampleRate, double AudioClock) override final;
 
@@ -75,6 +129,39 @@ private:
 	FCriticalSection AudioSyncContext;
 	FCriticalSection RenderSyncContext;
 
-	UTextureRenderTarget2D* VideoTexture = nullptr;
+	const USoundSubmix* MainSubmix = nullptr;
+	TMap<USoundSubmix*, int32> SubmixListenerCounts;
+	TMap<const USoundSubmix*, FNDISubmixAudioFramePtr> SubmixAudioFrames;
+
+	/** The common media clock from which audio and video timecodes are derived */
+	ENDITimecodeSource TimecodeSource = ENDITimecodeSource::SystemClock;
+	FFrameRate TimecodeFrameRate = FFrameRate(60, 1);
+	int64 TimecodeEpoch = 0;
+	bool bHasTimecodeEpoch = false;
+	uint64 TimecodeEpochCycles = 0;
+	int64 LastVideoFrameIndex = 0;
+	TMap<const USoundSubmix*, int64> SubmixSampleCounts;
+	double LastAudioClock = 0.0;
+	uint64 LastAudioClockCycles = 0;
+	FCriticalSection MediaClockSyncContext;
+
 	class UNDIMediaSender* ActiveViewportSender = nullptr;
+
+	/**
+		A window, other than the one of the active viewport, broadcast as a stream of its own. The streams of the
+		windows are texture streams of the active viewport sender, keyed on the window, so that they share its
+		conversion pass and readback
+	*/
+	struct FWindowOutput
+	{
+		TWeakPtr<SWindow> Window;
+		const SWindow* WindowKey = nullptr;
+		FString StreamName;
+		FIntPoint FrameSize = FIntPoint(0, 0);
+	};
+
+	bool bIsBroadcastingEveryWindow = false;
+	FString WindowStreamName;
+	FFrameRate WindowFrameRate;
+	TArray<FWindowOutput> WindowOutputs;
 };
\ No newline at end of file
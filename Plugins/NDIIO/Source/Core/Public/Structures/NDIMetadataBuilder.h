@@ -0,0 +1,118 @@
+/*
+	Copyright (C) 2023 Vizrt NDI AB. All rights reserved.
+
+	This file and it's use within a Product is bound by the terms of NDI SDK license that was provided
+	as part of the NDI SDK. For more information, please review the license and the NDI SDK documentation.
+*/
+
+#pragma once
+
+#include <CoreMinimal.h>
+#include <NDIIOPluginAPI.h>
+
+#include <atomic>
+
+/**
+	A pool of buffers for composing UTF-8 metadata, in size classes of powers of two from 256 bytes to 1 MB.
+	Released buffers are kept for reuse, so composing metadata of a steady size does not allocate.
+*/
+class NDIIO_API FNDIMetadataBufferPool
+{
+public:
+	/** Returns the pool shared by all metadata builders */
+	static FNDIMetadataBufferPool& Get();
+
+	~FNDIMetadataBufferPool();
+
+	/** Returns a buffer of at least MinCapacity bytes, along with its actual capacity */
+	char* Acquire(int32 MinCapacity, int32& OutCapacity);
+
+	/** Returns a buffer obtained from Acquire to the pool */
+	void Release(char* Buffer, int32 Capacity);
+
+	/** Returns the number of buffers allocated from the system, which stops increasing once the pool is warm */
+	int64 GetNumAllocations() const
+	{
+		return NumAllocations;
+	}
+
+private:
+	static constexpr int32 MinSizeClassBytes = 256;
+	static constexpr int32 NumSizeClasses = 13;
+
+	static int32 GetSizeClass(int32 Capacity);
+
+	FCriticalSection SyncContext;
+	TArray<char*> FreeBuffers[NumSizeClasses];
+	std::atomic<int64> NumAllocations { 0 };
+};
+
+/**
+	Composes metadata directly as null-terminated UTF-8 into a pooled buffer, for handing to
+	NDIlib_send_send_metadata or to the p_metadata of a video frame without any intermediate strings
+*/
+class NDIIO_API FNDIMetadataBuilder
+{
+public:
+	FNDIMetadataBuilder() = default;
+	~FNDIMetadataBuilder();
+
+	FNDIMetadataBuilder(const FNDIMetadataBuilder&) = delete;
+	FNDIMetadataBuilder& operator=(const FNDIMetadataBuilder&) = delete;
+
+	/** Clears the content, keeping the buffer for the next metadata */
+	void Reset();
+
+	/** Clears the content, and returns the buffer to the pool */
+	void Empty();
+
+	/** Exchanges the content and buffers of two builders */
+	void Swap(FNDIMetadataBuilder& Other);
+
+	bool IsEmpty() const
+	{
+		return Length == 0;
+	}
+
+	/** Returns the length in bytes of the UTF-8 content, excluding the terminating null */
+	int32 Len() const
+	{
+		return Length;
+	}
+
+	/** Returns the null-terminated UTF-8 content */
+	const char* GetData() const
+	{
+		return (Data != nullptr) ? Data : "";
+	}
+
+	FNDIMetadataBuilder& Append(const TCHAR* Text, int32 TextLen);
+	FNDIMetadataBuilder& Append(const FString& Text)
+	{
+		return Append(*Text, Text.Len());
+	}
+	FNDIMetadataBuilder& AppendUTF8(const char* Text, int32 TextLen);
+	FNDIMetadataBuilder& Append(const FNDIMetadataBuilder& Other)
+	{
+		return AppendUTF8(Other.GetData(), Other.Len());
+	}
+
+	/** Appends <Element>ElementData</Element> */
+	FNDIMetadataBuilder& AddElement(const FString& Element, const FString& ElementData);
+
+	/** Appends <Element, to be followed by attributes and CloseEmptyElement */
+	FNDIMetadataBuilder& OpenElement(const FString& Element);
+
+	/** Appends Key="Value" */
+	FNDIMetadataBuilder& AddAttribute(const FString& Key, const FString& Value);
+
+	/** Appends /> */
+	FNDIMetadataBuilder& CloseEmptyElement();
+
+private:
+	void Reserve(int32 NumBytes);
+
+	char* Data = nullptr;
+	int32 Length = 0;
+	int32 Capacity = 0;
+};
@@ -0,0 +1,71 @@
+/*
+	Copyright (C) 2023 Vizrt NDI AB. All rights reserved.
+
+	This file and it's use within a Product is bound by the terms of NDI SDK license that was provided
+	as part of the NDI SDK. For more information, please review the license and the NDI SDK documentation.
+*/
+
+#pragma once
+
+#include <CoreMinimal.h>
+
+#include <Enumerations/NDITallyState.h>
+#include <Structures/NDIConnectionInformation.h>
+
+#include "NDIMultiviewerTile.generated.h"
+
+/**
+	Describes a tile of a multiviewer, showing one source
+*/
+USTRUCT(BlueprintType, Blueprintable, Category = "NDI IO", META = (DisplayName = "NDI Multiviewer Tile"))
+struct NDIIO_API FNDIMultiviewerTile
+{
+	GENERATED_USTRUCT_BODY()
+
+public:
+	/** The source shown in the tile */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Tile", META = (DisplayName = "Source"))
+	FNDIConnectionInformation Source;
+
+	/** The label shown at the bottom of the tile, the name of the source when empty */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Tile", META = (DisplayName = "Label"))
+	FString Label = FString("");
+
+	/** The tally of the source, shown as the colour of the border of the tile */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Tile", META = (DisplayName = "Tally"))
+	ENDITallyState Tally = ENDITallyState::Off;
+
+public:
+	/** Constructs a new instance of this object */
+	FNDIMultiviewerTile() = default;
+
+	/** Copies an existing instance to this object */
+	FNDIMultiviewerTile(const FNDIMultiviewerTile& other);
+
+	/** Copies existing instance properties to this object */
+	FNDIMultiviewerTile& operator=(const FNDIMultiviewerTile& other);
+
+	/** Destructs this object */
+	virtual ~FNDIMultiviewerTile() = default;
+
+	/** Compares this object to 'other' and returns a determination of whether they are equal */
+	bool operator==(const FNDIMultiviewerTile& other) const;
+
+	/** Compares this object to 'other" and returns a determination of whether they are NOT equal */
+	bool operator!=(const FNDIMultiviewerTile& other) const;
+
+public:
+	/** Returns the label shown for the tile */
+	FString GetDisplayLabel() const;
+
+protected:
+	/** Attempts to serialize this object using an Archive object */
+	virtual FArchive& Serialize(FArchive& Ar);
+
+private:
+	/** Operator override for serializing this object to an Archive object */
+	friend class FArchive& operator<<(FArchive& Ar, FNDIMultiviewerTile& Input)
+	{
+		return Input.Serialize(Ar);
+	}
+};
@@ -0,0 +1,97 @@
+/*
+	Copyright (C) 2023 Vizrt NDI AB. All rights reserved.
+
+	This file and it's use within a Product is bound by the terms of NDI SDK license that was provided
+	as part of the NDI SDK. For more information, please review the license and the NDI SDK documentation.
+*/
+
+#pragma once
+
+#include <NDIIOPluginAPI.h>
+#include <Serialization/Archive.h>
+
+#include "NDIReceiverBusPerformanceData.generated.h"
+
+/**
+	A structure holding data allowing you to determine what keeping the sources of a receiver bus in standby costs,
+	and how quickly the bus cuts between them
+*/
+USTRUCT(BlueprintType, Blueprintable, Category = "NDI IO", META = (DisplayName = "NDI Receiver Bus Performance Data"))
+struct NDIIO_API FNDIReceiverBusPerformanceData
+{
+	GENERATED_USTRUCT_BODY()
+
+public:
+	/**
+		The number of sources connected in standby and ready to be cut to
+	*/
+	UPROPERTY(BlueprintReadOnly, VisibleAnywhere, Category = "Information",
+			  META = (DisplayName = "Standby Connections"))
+	int32 StandbyConnections = 0;
+
+	/**
+		The number of video frames received by the standby connections
+	*/
+	UPROPERTY(BlueprintReadOnly, VisibleAnywhere, Category = "Information",
+			  META = (DisplayName = "Standby Video Frames"))
+	int64 StandbyVideoFrames = 0;
+
+	/**
+		The estimated rate, in bytes per second, of the video decoded by the standby connections
+	*/
+	UPROPERTY(BlueprintReadOnly, VisibleAnywhere, Category = "Information",
+			  META = (DisplayName = "Standby Video Data Rate"))
+	int64 StandbyVideoDataRate = 0;
+
+	/**
+		The number of cuts made to a source connected in standby
+	*/
+	UPROPERTY(BlueprintReadOnly, VisibleAnywhere, Category = "Information", META = (DisplayName = "Cuts"))
+	int64 Cuts = 0;
+
+	/**
+		The number of cuts made to a source which was not connected in standby, and had to be connected first
+	*/
+	UPROPERTY(BlueprintReadOnly, VisibleAnywhere, Category = "Information", META = (DisplayName = "Cold Cuts"))
+	int64 ColdCuts = 0;
+
+	/**
+		The time, in seconds, between the last cut and the first frame of the new source being displayed
+	*/
+	UPROPERTY(BlueprintReadOnly, VisibleAnywhere, Category = "Information", META = (DisplayName = "Cut Latency"))
+	float CutLatency = 0.f;
+
+public:
+	/** Constructs a new instance of this object */
+	FNDIReceiverBusPerformanceData() = default;
+
+	/** Copies an existing instance to this object */
+	FNDIReceiverBusPerformanceData(const FNDIReceiverBusPerformanceData& other);
+
+	/** Copies existing instance properties to this object */
+	FNDIReceiverBusPerformanceData& operator=(const FNDIReceiverBusPerformanceData& other);
+
+	/** Destructs this object */
+	virtual ~FNDIReceiverBusPerformanceData() = default;
+
+	/** Compares this object to 'other' and returns a determination of whether they are equal */
+	bool operator==(const FNDIReceiverBusPerformanceData& other) const;
+
+	/** Compares this object to 'other" and returns a determination of whether they are NOT equal */
+	bool operator!=(const FNDIReceiverBusPerformanceData& other) const;
+
+public:
+	/** Resets the current parameters to the default property values */
+	void Reset();
+
+protected:
+	/** Attempts to serialize this object using an Archive object */
+	virtual FArchive& Serialize(FArchive& Ar);
+
+private:
+	/** Operator override for serializing this object to an Archive object */
+	friend class FArchive& operator<<(FArchive& Ar, FNDIReceiverBusPerformanceData& Input)
+	{
+		return Input.Serialize(Ar);
+	}
+};
@@ -61,6 +61,69 @@ public:
 	UPROPERTY(BlueprintReadOnly, VisibleAnywhere, Category = "Information", META = (DisplayName = "Video Frames"))
 	int64 VideoFrames = 0;
 
+	/**
+		The time, in seconds, between the last change of source and the first video frame of the new source
+	*/
+	UPROPERTY(BlueprintReadOnly, VisibleAnywhere, Category = "Information",
+			  META = (DisplayName = "Time To First Frame"))
+	float TimeToFirstFrame = 0.f;
+
+	/**
+		The time, in milliseconds, the render thread spent uploading the last video frame to the GPU. A time growing
+		close to the frame interval means the upload is stalling on the GPU.
+	*/
+	UPROPERTY(BlueprintReadOnly, VisibleAnywhere, Category = "Information",
+			  META = (DisplayName = "Video Upload Time"))
+	float VideoUploadTime = 0.f;
+
+	/**
+		The longest time, in milliseconds, the render thread spent uploading a video frame to the GPU
+	*/
+	UPROPERTY(BlueprintReadOnly, VisibleAnywhere, Category = "Information",
+			  META = (DisplayName = "Peak Video Upload Time"))
+	float PeakVideoUploadTime = 0.f;
+
+	/**
+		The time, in seconds, since anything was last received from the NDI sender
+	*/
+	UPROPERTY(BlueprintReadOnly, VisibleAnywhere, Category = "Information",
+			  META = (DisplayName = "Last Frame Age"))
+	float LastFrameAge = 0.f;
+
+	/**
+		The number of times the watchdog has reconnected to the NDI sender
+	*/
+	UPROPERTY(BlueprintReadOnly, VisibleAnywhere, Category = "Information", META = (DisplayName = "Reconnects"))
+	int64 Reconnects = 0;
+
+	/**
+		The time, in milliseconds, by which the audio heard is behind the video shown, as measured from the
+		timestamps of the frames received. Negative when the audio is ahead.
+	*/
+	UPROPERTY(BlueprintReadOnly, VisibleAnywhere, Category = "Information",
+			  META = (DisplayName = "Audio Video Offset"))
+	float AudioVideoOffset = 0.f;
+
+	/**
+		The time, in milliseconds, video frames are held for to align them with the audio
+	*/
+	UPROPERTY(BlueprintReadOnly, VisibleAnywhere, Category = "Information", META = (DisplayName = "Video Hold Time"))
+	float VideoHoldTime = 0.f;
+
+	/**
+		The time, in milliseconds, the audio is delayed by to align it with the video
+	*/
+	UPROPERTY(BlueprintReadOnly, VisibleAnywhere, Category = "Information", META = (DisplayName = "Audio Delay Time"))
+	float AudioDelayTime = 0.f;
+
+	/**
+		The time, in milliseconds, between the capture of the last video frame and the start of the first scene
+		rendering after it, which displays it. Late latching brings this down by the time the render thread waits
+		between frames, if any.
+	*/
+	UPROPERTY(BlueprintReadOnly, VisibleAnywhere, Category = "Information", META = (DisplayName = "Latch Latency"))
+	float LatchLatency = 0.f;
+
 public:
 	/** Constructs a new instance of this object */
 	FNDIReceiverPerformanceData() = default;
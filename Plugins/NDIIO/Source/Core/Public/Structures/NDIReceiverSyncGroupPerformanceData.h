@@ -0,0 +1,83 @@
+/*
+	Copyright (C) 2023 Vizrt NDI AB. All rights reserved.
+
+	This file and it's use within a Product is bound by the terms of NDI SDK license that was provided
+	as part of the NDI SDK. For more information, please review the license and the NDI SDK documentation.
+*/
+
+#pragma once
+
+#include <NDIIOPluginAPI.h>
+#include <Serialization/Archive.h>
+
+#include "NDIReceiverSyncGroupPerformanceData.generated.h"
+
+/**
+	A structure holding data allowing you to determine how well the frames of the members of a receiver sync group
+	are being matched, and what is lost doing so
+*/
+USTRUCT(BlueprintType, Blueprintable, Category = "NDI IO", META = (DisplayName = "NDI Receiver Sync Group Performance Data"))
+struct NDIIO_API FNDIReceiverSyncGroupPerformanceData
+{
+	GENERATED_USTRUCT_BODY()
+
+public:
+	/**
+		The number of sets of frames, one frame per member, matched and released to the render thread
+	*/
+	UPROPERTY(BlueprintReadOnly, VisibleAnywhere, Category = "Information", META = (DisplayName = "Matched Sets"))
+	int64 MatchedSets = 0;
+
+	/**
+		The number of frames dropped because they could not be matched with a frame of every other member, or because
+		they were pushed out of a full buffer while waiting for one
+	*/
+	UPROPERTY(BlueprintReadOnly, VisibleAnywhere, Category = "Information", META = (DisplayName = "Dropped Frames"))
+	int64 DroppedFrames = 0;
+
+	/**
+		The number of frames currently buffered, waiting to be matched
+	*/
+	UPROPERTY(BlueprintReadOnly, VisibleAnywhere, Category = "Information", META = (DisplayName = "Buffered Frames"))
+	int32 BufferedFrames = 0;
+
+	/**
+		The time, in milliseconds, between the earliest and the latest frame of the last matched set
+	*/
+	UPROPERTY(BlueprintReadOnly, VisibleAnywhere, Category = "Information", META = (DisplayName = "Match Spread"))
+	float MatchSpread = 0.f;
+
+public:
+	/** Constructs a new instance of this object */
+	FNDIReceiverSyncGroupPerformanceData() = default;
+
+	/** Copies an existing instance to this object */
+	FNDIReceiverSyncGroupPerformanceData(const FNDIReceiverSyncGroupPerformanceData& other);
+
+	/** Copies existing instance properties to this object */
+	FNDIReceiverSyncGroupPerformanceData& operator=(const FNDIReceiverSyncGroupPerformanceData& other);
+
+	/** Destructs this object */
+	virtual ~FNDIReceiverSyncGroupPerformanceData() = default;
+
+	/** Compares this object to 'other' and returns a determination of whether they are equal */
+	bool operator==(const FNDIReceiverSyncGroupPerformanceData& other) const;
+
+	/** Compares this object to 'other" and returns a determination of whether they are NOT equal */
+	bool operator!=(const FNDIReceiverSyncGroupPerformanceData& other) const;
+
+public:
+	/** Resets the current parameters to the default property values */
+	void Reset();
+
+protected:
+	/** Attempts to serialize this object using an Archive object */
+	virtual FArchive& Serialize(FArchive& Ar);
+
+private:
+	/** Operator override for serializing this object to an Archive object */
+	friend class FArchive& operator<<(FArchive& Ar, FNDIReceiverSyncGroupPerformanceData& Input)
+	{
+		return Input.Serialize(Ar);
+	}
+};
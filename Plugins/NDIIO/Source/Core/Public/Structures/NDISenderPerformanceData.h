@@ -0,0 +1,123 @@
+/*
+	Copyright (C) 2023 Vizrt NDI AB. All rights reserved.
+
+	This file and it's use within a Product is bound by the terms of NDI SDK license that was provided
+	as part of the NDI SDK. For more information, please review the license and the NDI SDK documentation.
+*/
+
+#pragma once
+
+#include <NDIIOPluginAPI.h>
+#include <Serialization/Archive.h>
+
+#include "NDISenderPerformanceData.generated.h"
+
+/**
+	A structure holding data allowing you to determine how well the sender keeps the cadence of its output
+	frame rate, and how many frames had to be repeated or decimated to do so
+*/
+USTRUCT(BlueprintType, Blueprintable, Category = "NDI IO", META = (DisplayName = "NDI Sender Performance Data"))
+struct NDIIO_API FNDISenderPerformanceData
+{
+	GENERATED_USTRUCT_BODY()
+
+public:
+	/**
+		The number of rendered video frames sent to the NDI receivers
+	*/
+	UPROPERTY(BlueprintReadOnly, VisibleAnywhere, Category = "Information", META = (DisplayName = "Video Frames"))
+	int64 VideoFrames = 0;
+
+	/**
+		The number of times the previous video frame was sent again because the engine was late for an output frame
+	*/
+	UPROPERTY(BlueprintReadOnly, VisibleAnywhere, Category = "Information",
+			  META = (DisplayName = "Repeated Video Frames"))
+	int64 RepeatedVideoFrames = 0;
+
+	/**
+		The number of rendered video frames not sent because the engine was early for the next output frame
+	*/
+	UPROPERTY(BlueprintReadOnly, VisibleAnywhere, Category = "Information",
+			  META = (DisplayName = "Decimated Video Frames"))
+	int64 DecimatedVideoFrames = 0;
+
+	/**
+		The number of output frames skipped because the engine was later than the repeat limit allows
+	*/
+	UPROPERTY(BlueprintReadOnly, VisibleAnywhere, Category = "Information",
+			  META = (DisplayName = "Skipped Video Frames"))
+	int64 SkippedVideoFrames = 0;
+
+	/**
+		The number of frames not converted and read back because their content was identical to the last frame sent
+	*/
+	UPROPERTY(BlueprintReadOnly, VisibleAnywhere, Category = "Information",
+			  META = (DisplayName = "Unchanged Video Frames"))
+	int64 UnchangedVideoFrames = 0;
+
+	/**
+		The average difference (in milliseconds) between the time elapsed between two sent frames,
+		and the time their output frames are apart
+	*/
+	UPROPERTY(BlueprintReadOnly, VisibleAnywhere, Category = "Information",
+			  META = (DisplayName = "Average Cadence Error (ms)"))
+	float AverageCadenceError = 0.f;
+
+	/**
+		The largest difference (in milliseconds) between the time elapsed between two sent frames,
+		and the time their output frames are apart
+	*/
+	UPROPERTY(BlueprintReadOnly, VisibleAnywhere, Category = "Information",
+			  META = (DisplayName = "Maximum Cadence Error (ms)"))
+	float MaximumCadenceError = 0.f;
+
+	/**
+		The number of metadata frames sent, either on their own or attached to a video frame
+	*/
+	UPROPERTY(BlueprintReadOnly, VisibleAnywhere, Category = "Information",
+			  META = (DisplayName = "Metadata Frames"))
+	int64 MetadataFrames = 0;
+
+	/**
+		The number of buffers the metadata pool shared by all senders has allocated,
+		which stops increasing once the pool holds buffers for the sizes of metadata sent
+	*/
+	UPROPERTY(BlueprintReadOnly, VisibleAnywhere, Category = "Information",
+			  META = (DisplayName = "Metadata Buffer Allocations"))
+	int64 MetadataBufferAllocations = 0;
+
+public:
+	/** Constructs a new instance of this object */
+	FNDISenderPerformanceData() = default;
+
+	/** Copies an existing instance to this object */
+	FNDISenderPerformanceData(const FNDISenderPerformanceData& other);
+
+	/** Copies existing instance properties to this object */
+	FNDISenderPerformanceData& operator=(const FNDISenderPerformanceData& other);
+
+	/** Destructs this object */
+	virtual ~FNDISenderPerformanceData() = default;
+
+	/** Compares this object to 'other' and returns a determination of whether they are equal */
+	bool operator==(const FNDISenderPerformanceData& other) const;
+
+	/** Compares this object to 'other" and returns a determination of whether they are NOT equal */
+	bool operator!=(const FNDISenderPerformanceData& other) const;
+
+public:
+	/** Resets the current parameters to the default property values */
+	void Reset();
+
+protected:
+	/** Attempts to serialize this object using an Archive object */
+	virtual FArchive& Serialize(FArchive& Ar);
+
+private:
+	/** Operator override for serializing this object to an Archive object */
+	friend class FArchive& operator<<(FArchive& Ar, FNDISenderPerformanceData& Input)
+	{
+		return Input.Serialize(Ar);
+	}
+};
@@ -0,0 +1,68 @@
+/*
+	Copyright (C) 2023 Vizrt NDI AB. All rights reserved.
+
+	This file and it's use within a Product is bound by the terms of NDI SDK license that was provided
+	as part of the NDI SDK. For more information, please review the license and the NDI SDK documentation.
+*/
+
+#pragma once
+
+#include <CoreMinimal.h>
+
+#include "NDISenderRegion.generated.h"
+
+/**
+	Describes a rectangle of a sender's render target, published as an NDI stream of its own
+*/
+USTRUCT(BlueprintType, Blueprintable, Category = "NDI IO", META = (DisplayName = "NDI Sender Region"))
+struct NDIIO_API FNDISenderRegion
+{
+	GENERATED_USTRUCT_BODY()
+
+public:
+	/** The name of the region, the stream is seen on the network as "<Source Name> (<Name>)" */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Region", META = (DisplayName = "Name"))
+	FString Name = TEXT("Region");
+
+	/** The position (in pixels) of the top left corner of the region in the input texture */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Region", META = (DisplayName = "Offset"))
+	FIntPoint Offset = FIntPoint(0, 0);
+
+	/**
+		The size (in pixels) of the region, which is also the frame size of its stream. The region is clamped to the
+		input texture the sender converts, which may be larger than its frame size, such as the backbuffer of the
+		viewport; a region entirely outside of it is not sent
+	*/
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Region", META = (DisplayName = "Size"))
+	FIntPoint Size = FIntPoint(1920, 1080);
+
+public:
+	/** Constructs a new instance of this object */
+	FNDISenderRegion() = default;
+
+	/** Copies an existing instance to this object */
+	FNDISenderRegion(const FNDISenderRegion& other);
+
+	/** Copies existing instance properties to this object */
+	FNDISenderRegion& operator=(const FNDISenderRegion& other);
+
+	/** Destructs this object */
+	virtual ~FNDISenderRegion() = default;
+
+	/** Compares this object to 'other' and returns a determination of whether they are equal */
+	bool operator==(const FNDISenderRegion& other) const;
+
+	/** Compares this object to 'other" and returns a determination of whether they are NOT equal */
+	bool operator!=(const FNDISenderRegion& other) const;
+
+protected:
+	/** Attempts to serialize this object using an Archive object */
+	virtual FArchive& Serialize(FArchive& Ar);
+
+private:
+	/** Operator override for serializing this object to an Archive object */
+	friend class FArchive& operator<<(FArchive& Ar, FNDISenderRegion& Input)
+	{
+		return Input.Serialize(Ar);
+	}
+};
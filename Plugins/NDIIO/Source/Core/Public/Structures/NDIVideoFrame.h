@@ -0,0 +1,121 @@
+/*
+	Copyright (C) 2023 Vizrt NDI AB. All rights reserved.
+
+	This file and it's use within a Product is bound by the terms of NDI SDK license that was provided
+	as part of the NDI SDK. For more information, please review the license and the NDI SDK documentation.
+*/
+
+#pragma once
+
+#include <CoreMinimal.h>
+#include <NDIIOPluginAPI.h>
+#include <Misc/FrameRate.h>
+#include <Templates/SharedPointer.h>
+
+/**
+	Owns a receiver and its frame sync, and destroys them once the last reference is released. Frames captured from
+	a connection must be freed to the instance which captured them, so every frame handed out keeps its connection
+	alive, even after the receiver has moved on to another source.
+*/
+class NDIIO_API FNDIReceiverConnection
+{
+public:
+	FNDIReceiverConnection(NDIlib_recv_instance_t InReceiveInstance, NDIlib_framesync_instance_t InFramesyncInstance);
+	~FNDIReceiverConnection();
+
+	FNDIReceiverConnection(const FNDIReceiverConnection&) = delete;
+	FNDIReceiverConnection& operator=(const FNDIReceiverConnection&) = delete;
+
+	NDIlib_recv_instance_t GetReceiveInstance() const
+	{
+		return p_receive_instance;
+	}
+
+	NDIlib_framesync_instance_t GetFramesyncInstance() const
+	{
+		return p_framesync_instance;
+	}
+
+private:
+	NDIlib_recv_instance_t p_receive_instance = nullptr;
+	NDIlib_framesync_instance_t p_framesync_instance = nullptr;
+};
+
+/**
+	A video frame received over NDI, in the buffer the NDI SDK captured it into. The buffer is returned to the NDI SDK
+	when the frame is destroyed, so a frame shared through FNDIVideoFrameRef can be read on any thread, for as long as
+	it is referenced, without copying the pixels.
+*/
+class NDIIO_API FNDIVideoFrame
+{
+public:
+	FNDIVideoFrame(const TSharedRef<FNDIReceiverConnection, ESPMode::ThreadSafe>& InConnection, const NDIlib_video_frame_v2_t& InFrame);
+	~FNDIVideoFrame();
+
+	FNDIVideoFrame(const FNDIVideoFrame&) = delete;
+	FNDIVideoFrame& operator=(const FNDIVideoFrame&) = delete;
+
+	/** Returns the frame as captured from the NDI SDK */
+	const NDIlib_video_frame_v2_t& GetFrame() const
+	{
+		return Frame;
+	}
+
+	/** Returns the pixels of the frame, in the layout given by its FourCC */
+	const uint8* GetData() const
+	{
+		return Frame.p_data;
+	}
+
+	/** Returns the number of bytes between the start of two lines of the frame */
+	int32 GetLineStride() const
+	{
+		return Frame.line_stride_in_bytes;
+	}
+
+	/** Returns the width and height of the frame, in pixels */
+	FIntPoint GetResolution() const
+	{
+		return FIntPoint(Frame.xres, Frame.yres);
+	}
+
+	NDIlib_FourCC_video_type_e GetFourCC() const
+	{
+		return Frame.FourCC;
+	}
+
+	NDIlib_frame_format_type_e GetFrameFormatType() const
+	{
+		return Frame.frame_format_type;
+	}
+
+	FFrameRate GetFrameRate() const
+	{
+		return FFrameRate(Frame.frame_rate_N, Frame.frame_rate_D);
+	}
+
+	/** Returns the timecode of the frame, in 100ns intervals */
+	int64 GetTimecode() const
+	{
+		return Frame.timecode;
+	}
+
+	/** Returns the time the frame was sent at, in 100ns intervals, or NDIlib_recv_timestamp_undefined */
+	int64 GetTimestamp() const
+	{
+		return Frame.timestamp;
+	}
+
+	/** Returns the UTF-8 metadata attached to the frame, or nullptr */
+	const char* GetMetadata() const
+	{
+		return Frame.p_metadata;
+	}
+
+private:
+	TSharedRef<FNDIReceiverConnection, ESPMode::ThreadSafe> Connection;
+	NDIlib_video_frame_v2_t Frame;
+};
+
+using FNDIVideoFrameRef = TSharedRef<const FNDIVideoFrame, ESPMode::ThreadSafe>;
+using FNDIVideoFramePtr = TSharedPtr<const FNDIVideoFrame, ESPMode::ThreadSafe>;
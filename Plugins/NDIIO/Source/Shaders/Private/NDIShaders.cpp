@@ -47,12 +47,48 @@ END_GLOBAL_SHADER_PARAMETER_STRUCT()
 
 IMPLEMENT_GLOBAL_SHADER_PARAMETER_STRUCT(FNDIIOShaderUB, "NDIIOShaderUB");
 
+BEGIN_GLOBAL_SHADER_PARAMETER_STRUCT(FNDIIOMultiviewerUB, )
+	SHADER_PARAMETER(uint32, OutputWidth)
+	SHADER_PARAMETER(uint32, OutputHeight)
+	SHADER_PARAMETER(uint32, AtlasWidth)
+	SHADER_PARAMETER(uint32, AtlasHeight)
+	SHADER_PARAMETER(uint32, Columns)
+	SHADER_PARAMETER(uint32, Rows)
+	SHADER_PARAMETER(uint32, NumTiles)
+	SHADER_PARAMETER(uint32, LabelWidth)
+	SHADER_PARAMETER(uint32, LabelHeight)
+	SHADER_PARAMETER(uint32, BorderWidth)
+	SHADER_PARAMETER(uint32, MeterWidth)
+	SHADER_PARAMETER(uint32, ColorCorrection)
+#if ENGINE_MAJOR_VERSION == 5
+	SHADER_PARAMETER_ARRAY(FVector4f, TileSources, [FNDIIOShaderMultiviewerPS::MaxTiles])
+	SHADER_PARAMETER_ARRAY(FVector4f, TileBorders, [FNDIIOShaderMultiviewerPS::MaxTiles])
+	SHADER_PARAMETER_ARRAY(FVector4f, TileLevels, [FNDIIOShaderMultiviewerPS::MaxTiles])
+#elif ENGINE_MAJOR_VERSION == 4
+	SHADER_PARAMETER_ARRAY(FVector4, TileSources, [FNDIIOShaderMultiviewerPS::MaxTiles])
+	SHADER_PARAMETER_ARRAY(FVector4, TileBorders, [FNDIIOShaderMultiviewerPS::MaxTiles])
+	SHADER_PARAMETER_ARRAY(FVector4, TileLevels, [FNDIIOShaderMultiviewerPS::MaxTiles])
+#else
+	#error "Unsupported engine major version"
+#endif
+	SHADER_PARAMETER_TEXTURE(Texture2D, AtlasTarget)
+	SHADER_PARAMETER_TEXTURE(Texture2D, LabelTarget)
+	SHADER_PARAMETER_SAMPLER(SamplerState, SamplerP)
+END_GLOBAL_SHADER_PARAMETER_STRUCT()
+
+IMPLEMENT_GLOBAL_SHADER_PARAMETER_STRUCT(FNDIIOMultiviewerUB, "NDIIOMultiviewerUB");
+
 IMPLEMENT_GLOBAL_SHADER(FNDIIOShaderVS, "/Plugin/NDIIOPlugin/Private/NDIIOShaders.usf", "NDIIOMainVS", SF_Vertex);
 IMPLEMENT_GLOBAL_SHADER(FNDIIOShaderBGRAtoUYVYPS, "/Plugin/NDIIOPlugin/Private/NDIIOShaders.usf", "NDIIOBGRAtoUYVYPS", SF_Pixel);
 IMPLEMENT_GLOBAL_SHADER(FNDIIOShaderBGRAtoAlphaEvenPS, "/Plugin/NDIIOPlugin/Private/NDIIOShaders.usf", "NDIIOBGRAtoAlphaEvenPS", SF_Pixel);
 IMPLEMENT_GLOBAL_SHADER(FNDIIOShaderBGRAtoAlphaOddPS, "/Plugin/NDIIOPlugin/Private/NDIIOShaders.usf", "NDIIOBGRAtoAlphaOddPS", SF_Pixel);
+IMPLEMENT_GLOBAL_SHADER(FNDIIOShaderBGRAtoY16PS, "/Plugin/NDIIOPlugin/Private/NDIIOShaders.usf", "NDIIOBGRAtoY16PS", SF_Pixel);
+IMPLEMENT_GLOBAL_SHADER(FNDIIOShaderBGRAtoCbCr16PS, "/Plugin/NDIIOPlugin/Private/NDIIOShaders.usf", "NDIIOBGRAtoCbCr16PS", SF_Pixel);
+IMPLEMENT_GLOBAL_SHADER(FNDIIOShaderBGRAtoA16PS, "/Plugin/NDIIOPlugin/Private/NDIIOShaders.usf", "NDIIOBGRAtoA16PS", SF_Pixel);
+IMPLEMENT_GLOBAL_SHADER(FNDIIOShaderFingerprintPS, "/Plugin/NDIIOPlugin/Private/NDIIOShaders.usf", "NDIIOFingerprintPS", SF_Pixel);
 IMPLEMENT_GLOBAL_SHADER(FNDIIOShaderUYVYtoBGRAPS, "/Plugin/NDIIOPlugin/Private/NDIIOShaders.usf", "NDIIOUYVYtoBGRAPS", SF_Pixel);
 IMPLEMENT_GLOBAL_SHADER(FNDIIOShaderUYVAtoBGRAPS, "/Plugin/NDIIOPlugin/Private/NDIIOShaders.usf", "NDIIOUYVAtoBGRAPS", SF_Pixel);
+IMPLEMENT_GLOBAL_SHADER(FNDIIOShaderMultiviewerPS, "/Plugin/NDIIOPlugin/Private/NDIIOShaders.usf", "NDIIOMultiviewerPS", SF_Pixel);
 
 
 
@@ -111,6 +147,54 @@ void FNDIIOShaderPS::SetParameters(FRHICommandList& CommandList, const Params& p
 #endif
 }
 
+void FNDIIOShaderMultiviewerPS::SetParameters(FRHICommandList& CommandList, const Params& params)
+{
+	FNDIIOMultiviewerUB UB;
+	{
+		UB.OutputWidth = params.OutputSize.X;
+		UB.OutputHeight = params.OutputSize.Y;
+		UB.AtlasWidth = params.AtlasTarget->GetSizeX();
+		UB.AtlasHeight = params.AtlasTarget->GetSizeY();
+		UB.Columns = FMath::Max(params.Columns, 1);
+		UB.Rows = FMath::Max(params.Rows, 1);
+		UB.NumTiles = FMath::Min(params.Tiles.Num(), MaxTiles);
+		UB.LabelWidth = params.LabelSize.X;
+		UB.LabelHeight = params.LabelSize.Y;
+		UB.BorderWidth = params.BorderWidth;
+		UB.MeterWidth = params.MeterWidth;
+		UB.ColorCorrection = static_cast<uint32>(params.bPerformsRGBtoLinear ? FNDIIOShaderPS::EColorCorrection::sRGBToLinear : FNDIIOShaderPS::EColorCorrection::None);
+
+		for (int32 TileIndex = 0; TileIndex < MaxTiles; ++TileIndex)
+		{
+			const Tile& TileParams = params.Tiles.IsValidIndex(TileIndex) ? params.Tiles[TileIndex] : Tile();
+#if ENGINE_MAJOR_VERSION == 5
+			UB.TileSources[TileIndex] = FVector4f(TileParams.AtlasOffset.X, TileParams.AtlasOffset.Y, TileParams.SourceSize.X, TileParams.SourceSize.Y);
+			UB.TileBorders[TileIndex] = FVector4f(TileParams.BorderColor.R, TileParams.BorderColor.G, TileParams.BorderColor.B, TileParams.BorderColor.A);
+			UB.TileLevels[TileIndex] = FVector4f((float)TileParams.AudioLevels.X, (float)TileParams.AudioLevels.Y, 0.f, 0.f);
+#elif ENGINE_MAJOR_VERSION == 4
+			UB.TileSources[TileIndex] = FVector4(TileParams.AtlasOffset.X, TileParams.AtlasOffset.Y, TileParams.SourceSize.X, TileParams.SourceSize.Y);
+			UB.TileBorders[TileIndex] = FVector4(TileParams.BorderColor.R, TileParams.BorderColor.G, TileParams.BorderColor.B, TileParams.BorderColor.A);
+			UB.TileLevels[TileIndex] = FVector4(TileParams.AudioLevels.X, TileParams.AudioLevels.Y, 0.f, 0.f);
+#else
+			#error "Unsupported engine major version"
+#endif
+		}
+
+		UB.AtlasTarget = params.AtlasTarget;
+		UB.LabelTarget = params.LabelTarget;
+		UB.SamplerP = TStaticSamplerState<SF_Point>::GetRHI();
+	}
+
+	TUniformBufferRef<FNDIIOMultiviewerUB> Data = TUniformBufferRef<FNDIIOMultiviewerUB>::CreateUniformBufferImmediate(UB, UniformBuffer_SingleFrame);
+#if (ENGINE_MAJOR_VERSION > 5) || ((ENGINE_MAJOR_VERSION == 5) && (ENGINE_MINOR_VERSION >= 3))
+	FRHIBatchedShaderParameters& BatchedParameters = CommandList.GetScratchShaderParameters();
+	SetUniformBufferParameter(BatchedParameters, GetUniformBufferParameter<FNDIIOMultiviewerUB>(), Data);
+	CommandList.SetBatchedShaderParameters(CommandList.GetBoundPixelShader(), BatchedParameters);
+#else
+	SetUniformBufferParameter(CommandList, CommandList.GetBoundPixelShader(), GetUniformBufferParameter<FNDIIOMultiviewerUB>(), Data);
+#endif
+}
+
 
 class FNDIIOShaders : public INDIIOShaders
 {
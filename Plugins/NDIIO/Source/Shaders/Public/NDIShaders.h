@@ -116,6 +116,44 @@ public:
 	using FNDIIOShaderPS::FNDIIOShaderPS;
 };
 
+class FNDIIOShaderBGRAtoY16PS : public FNDIIOShaderPS
+{
+	DECLARE_EXPORTED_SHADER_TYPE(FNDIIOShaderBGRAtoY16PS, Global, NDIIOSHADERS_API);
+
+public:
+	using FNDIIOShaderPS::FNDIIOShaderPS;
+};
+
+class FNDIIOShaderBGRAtoCbCr16PS : public FNDIIOShaderPS
+{
+	DECLARE_EXPORTED_SHADER_TYPE(FNDIIOShaderBGRAtoCbCr16PS, Global, NDIIOSHADERS_API);
+
+public:
+	using FNDIIOShaderPS::FNDIIOShaderPS;
+};
+
+class FNDIIOShaderBGRAtoA16PS : public FNDIIOShaderPS
+{
+	DECLARE_EXPORTED_SHADER_TYPE(FNDIIOShaderBGRAtoA16PS, Global, NDIIOSHADERS_API);
+
+public:
+	using FNDIIOShaderPS::FNDIIOShaderPS;
+};
+
+class FNDIIOShaderFingerprintPS : public FNDIIOShaderPS
+{
+	DECLARE_EXPORTED_SHADER_TYPE(FNDIIOShaderFingerprintPS, Global, NDIIOSHADERS_API);
+
+public:
+	using FNDIIOShaderPS::FNDIIOShaderPS;
+
+	static void ModifyCompilationEnvironment(const FGlobalShaderPermutationParameters& Parameters, FShaderCompilerEnvironment& OutEnvironment)
+	{
+		FNDIIOShaderPS::ModifyCompilationEnvironment(Parameters, OutEnvironment);
+		OutEnvironment.SetRenderTargetOutputFormat(0, PF_R32_UINT);
+	}
+};
+
 class FNDIIOShaderUYVYtoBGRAPS : public FNDIIOShaderPS
 {
 	DECLARE_EXPORTED_SHADER_TYPE(FNDIIOShaderUYVYtoBGRAPS, Global, NDIIOSHADERS_API);
@@ -132,6 +170,61 @@ public:
 	using FNDIIOShaderPS::FNDIIOShaderPS;
 };
 
+class FNDIIOShaderMultiviewerPS : public FGlobalShader
+{
+	DECLARE_EXPORTED_SHADER_TYPE(FNDIIOShaderMultiviewerPS, Global, NDIIOSHADERS_API);
+
+public:
+	/** The number of tiles a single pass composes */
+	static constexpr int32 MaxTiles = 64;
+
+	static bool ShouldCompilePermutation(const FGlobalShaderPermutationParameters& Parameters)
+	{
+		return IsFeatureLevelSupported(Parameters.Platform, ERHIFeatureLevel::ES3_1);
+	}
+
+	static void ModifyCompilationEnvironment(const FGlobalShaderPermutationParameters& Parameters, FShaderCompilerEnvironment& OutEnvironment)
+	{
+		FGlobalShader::ModifyCompilationEnvironment(Parameters, OutEnvironment);
+		OutEnvironment.SetDefine(TEXT("NDIIO_MULTIVIEWER_MAX_TILES"), MaxTiles);
+	}
+
+	FNDIIOShaderMultiviewerPS()
+	{}
+
+	FNDIIOShaderMultiviewerPS(const ShaderMetaType::CompiledShaderInitializerType& Initializer)
+		: FGlobalShader(Initializer)
+	{}
+
+	struct Tile
+	{
+		/** Where the UYVY frame of the tile is in the atlas, in texels of the atlas */
+		FIntPoint AtlasOffset = FIntPoint(0, 0);
+		/** The size of the frame of the tile in pixels, zero when there is no frame to show */
+		FIntPoint SourceSize = FIntPoint(0, 0);
+		FLinearColor BorderColor = FLinearColor::Black;
+		/** The peak levels of the left and right channels, from 0 to 1 */
+		FVector2D AudioLevels = FVector2D(0, 0);
+	};
+
+	struct Params
+	{
+		TRefCountPtr<FRHITexture2D> AtlasTarget;
+		TRefCountPtr<FRHITexture2D> LabelTarget;
+		FIntPoint OutputSize;
+		int32 Columns = 1;
+		int32 Rows = 1;
+		/** The size of the label of each tile, the labels being stacked in rows of the label target */
+		FIntPoint LabelSize;
+		int32 BorderWidth = 0;
+		int32 MeterWidth = 0;
+		bool bPerformsRGBtoLinear = true;
+		TArray<Tile> Tiles;
+	};
+
+	NDIIOSHADERS_API void SetParameters(FRHICommandList& CommandList, const Params& params);
+};
+
 class INDIIOShaders : public IModuleInterface
 {
 public:
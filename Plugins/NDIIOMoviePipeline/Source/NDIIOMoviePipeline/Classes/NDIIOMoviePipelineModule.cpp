@@ -0,0 +1,10 @@
+/*
+	Copyright (C) 2023 Vizrt NDI AB. All rights reserved.
+
+	This file and it's use within a Product is bound by the terms of NDI SDK license that was provided
+	as part of the NDI SDK. For more information, please review the license and the NDI SDK documentation.
+*/
+
+#include <Modules/ModuleManager.h>
+
+IMPLEMENT_MODULE(FDefaultModuleImpl, NDIIOMoviePipeline);
@@ -0,0 +1,260 @@
+/*
+	Copyright (C) 2023 Vizrt NDI AB. All rights reserved.
+
+	This file and it's use within a Product is bound by the terms of NDI SDK license that was provided
+	as part of the NDI SDK. For more information, please review the license and the NDI SDK documentation.
+*/
+
+#include <NDIMoviePipelineOutput.h>
+
+#include <MoviePipeline.h>
+#include <MovieRenderPipelineDataTypes.h>
+#include <MoviePipelineOutputSetting.h>
+#include <ImagePixelData.h>
+#include <LevelSequence.h>
+#include <HAL/PlatformProcess.h>
+#include <HAL/PlatformTime.h>
+#include <Misc/EngineVersionComparison.h>
+#if (ENGINE_MAJOR_VERSION > 5) || ((ENGINE_MAJOR_VERSION == 5) && (ENGINE_MINOR_VERSION >= 2))
+#include <MoviePipelinePrimaryConfig.h>
+#else
+#include <MoviePipelineMasterConfig.h>
+#endif
+
+#define LOCTEXT_NAMESPACE "NDIMoviePipelineOutput"
+
+
+void UNDIMoviePipelineOutput::SetupForPipelineImpl(UMoviePipeline* InPipeline)
+{
+	Super::SetupForPipelineImpl(InPipeline);
+
+#if (ENGINE_MAJOR_VERSION > 5) || ((ENGINE_MAJOR_VERSION == 5) && (ENGINE_MINOR_VERSION >= 2))
+	UMoviePipelinePrimaryConfig* Config = InPipeline->GetPipelinePrimaryConfig();
+#else
+	UMoviePipelineMasterConfig* Config = InPipeline->GetPipelineMasterConfig();
+#endif
+
+	// Frames are sent at the frame rate of the render, whatever the time it takes to render them
+	this->FrameRate = Config->GetEffectiveFrameRate(InPipeline->GetTargetSequence());
+
+	FNDIBroadcastConfiguration Configuration;
+	Configuration.FrameRate = this->FrameRate;
+	if (UMoviePipelineOutputSetting* OutputSetting = Config->FindSetting<UMoviePipelineOutputSetting>())
+		Configuration.FrameSize = OutputSetting->OutputResolution;
+
+	this->Sender = NewObject<UNDIMediaSender>(this, NAME_None, RF_Transient);
+	this->Sender->ChangeSourceName(SourceName);
+	this->Sender->ChangeBroadcastConfiguration(Configuration);
+
+	// Float frames are linear, while 8 bits frames are already encoded for display
+	this->Sender->PerformLinearTosRGBConversion(true);
+	this->Sender->EnablePTZ(false);
+	this->Sender->Initialize();
+
+	SentAudioSegments.Reset();
+	bHasStartedPlayout = false;
+	bHasReceiverTimedOut = false;
+}
+
+void UNDIMoviePipelineOutput::TeardownForPipelineImpl(UMoviePipeline* InPipeline)
+{
+	if (IsValid(this->Sender))
+	{
+		// The audio of the render only replaces the audio of the submix for the duration of the job
+		this->Sender->StopSendingAudioFromCPU();
+		this->Sender->Shutdown();
+		this->Sender = nullptr;
+	}
+
+	ConversionBuffer.Empty();
+	SentAudioSegments.Reset();
+
+	Super::TeardownForPipelineImpl(InPipeline);
+}
+
+void UNDIMoviePipelineOutput::OnReceiveImageDataImpl(FMoviePipelineMergerOutputFrame* InMergedOutputFrame)
+{
+	if (!IsValid(this->Sender) || (InMergedOutputFrame == nullptr))
+		return;
+
+	// Only one image is sent per frame: the final image if there is one, else the first pass rendered
+	const FImagePixelData* ImageData = nullptr;
+	for (const auto& ImageOutput : InMergedOutputFrame->ImageOutputData)
+	{
+		if ((ImageData == nullptr) || (ImageOutput.Key.Name == TEXT("FinalImage")))
+			ImageData = ImageOutput.Value.Get();
+	}
+
+	const void* RawData = nullptr;
+	int64 RawSizeInBytes = 0;
+	if ((ImageData == nullptr) || !ImageData->GetRawData(RawData, RawSizeInBytes))
+		return;
+
+	FIntPoint Size = ImageData->GetSize();
+	const uint8* Pixels = static_cast<const uint8*>(RawData);
+	EPixelFormat PixelFormat = PF_Unknown;
+	int32 StrideInBytes = 0;
+
+	switch (ImageData->GetType())
+	{
+		case EImagePixelType::Color:
+			PixelFormat = PF_B8G8R8A8;
+			StrideInBytes = Size.X * sizeof(FColor);
+			break;
+
+		case EImagePixelType::Float16:
+			PixelFormat = PF_FloatRGBA;
+			StrideInBytes = Size.X * sizeof(FFloat16Color);
+			break;
+
+		case EImagePixelType::Float32:
+		{
+			// Full float pixels are quantized to BGRA8 first, with the same color correction as half floats
+			const FLinearColor* SrcPixels = static_cast<const FLinearColor*>(RawData);
+			ConversionBuffer.SetNumUninitialized(Size.X * Size.Y, false);
+			for (int32 Index = 0; Index < ConversionBuffer.Num(); ++Index)
+			{
+				ConversionBuffer[Index] = SrcPixels[Index].ToFColor(true);
+			}
+
+			Pixels = reinterpret_cast<const uint8*>(ConversionBuffer.GetData());
+			PixelFormat = PF_B8G8R8A8;
+			StrideInBytes = Size.X * sizeof(FColor);
+			break;
+		}
+
+		default:
+			return;
+	}
+
+	// Frames of NDI hold pairs of pixels, so an odd last column is left out
+	FIntPoint SendSize(Size.X & ~1, Size.Y);
+
+	// The timecode of the frame in the sequence, rather than the time it was rendered at. A timecode of 0 would have
+	// the NDI SDK synthesize one, so a sequence starting at 00:00:00:00 has its first frame 100ns later.
+	int64 Timecode = InMergedOutputFrame->FrameOutputState.SourceTimeCode.ToTimespan(FrameRate).GetTicks();
+	Timecode = FMath::Max<int64>(Timecode, 1);
+
+	if (Playout == ENDIMoviePipelinePlayout::RealTime)
+		WaitForPlayoutTime(InMergedOutputFrame->FrameOutputState.OutputFrameNumber);
+
+	if (bWaitForReceiver == true)
+		WaitForReceiver();
+
+	if (this->Sender->SendVideoFrameFromCPU(Pixels, PixelFormat, SendSize, StrideInBytes, Timecode))
+	{
+		// The render does not move on until the frame has left, so that receivers get every frame
+		if (Playout == ENDIMoviePipelinePlayout::BackPressure)
+			this->Sender->WaitForVideoFrameFromCPU();
+	}
+
+	if (bSendAudio == true)
+		SendFinishedAudioSegments();
+}
+
+void UNDIMoviePipelineOutput::BeginFinalizeImpl()
+{
+	// The audio of the last shot is complete once the render is finalized
+	if (IsValid(this->Sender) && (bSendAudio == true))
+		SendFinishedAudioSegments();
+
+	Super::BeginFinalizeImpl();
+}
+
+#if WITH_EDITOR
+FText UNDIMoviePipelineOutput::GetDisplayText() const
+{
+	return LOCTEXT("NDIOutput_DisplayText", "NDI Output");
+}
+#endif
+
+/**
+	Waits for a receiver to connect, until the timeout elapses. Once the timeout has elapsed, frames are no longer
+	held back until a receiver connects.
+*/
+bool UNDIMoviePipelineOutput::WaitForReceiver()
+{
+	int32 NumConnections = 0;
+	this->Sender->GetNumberOfConnections(NumConnections);
+
+	if ((NumConnections <= 0) && (bHasReceiverTimedOut == false))
+	{
+		double Deadline = FPlatformTime::Seconds() + ReceiverTimeout;
+		while ((NumConnections <= 0) && (FPlatformTime::Seconds() < Deadline))
+		{
+			FPlatformProcess::Sleep(0.01f);
+			this->Sender->GetNumberOfConnections(NumConnections);
+		}
+
+		bHasReceiverTimedOut = (NumConnections <= 0);
+	}
+	else if (NumConnections > 0)
+	{
+		bHasReceiverTimedOut = false;
+	}
+
+	return NumConnections > 0;
+}
+
+/**
+	Waits until a frame is due in real time. Frames rendered late are sent immediately, and the following frames
+	are spaced from them, so that frames are never sent in bursts.
+*/
+void UNDIMoviePipelineOutput::WaitForPlayoutTime(int32 OutputFrameNumber)
+{
+	uint64 NowCycles = FPlatformTime::Cycles64();
+
+	if ((bHasStartedPlayout == true) && (OutputFrameNumber > PlayoutStartFrame))
+	{
+		double DueTime = (OutputFrameNumber - PlayoutStartFrame) * FrameRate.AsInterval();
+		double ElapsedTime = (NowCycles - PlayoutStartCycles) * FPlatformTime::GetSecondsPerCycle64();
+
+		if (DueTime > ElapsedTime)
+		{
+			FPlatformProcess::Sleep((float)(DueTime - ElapsedTime));
+			return;
+		}
+	}
+
+	// The first frame, or a late frame, starts the playout again
+	PlayoutStartCycles = NowCycles;
+	PlayoutStartFrame = OutputFrameNumber;
+	bHasStartedPlayout = true;
+}
+
+/**
+	Sends the audio segments the Movie Render Queue has completed since the last call, in chunks of one frame,
+	with timecodes following on from the timecode of the segment
+*/
+void UNDIMoviePipelineOutput::SendFinishedAudioSegments()
+{
+	UMoviePipeline* Pipeline = GetPipeline();
+	if (Pipeline == nullptr)
+		return;
+
+	for (const auto& Segment : Pipeline->GetAudioState().FinishedSegments)
+	{
+		if (SentAudioSegments.Contains(Segment.Id))
+			continue;
+
+		SentAudioSegments.Add(Segment.Id);
+
+		if ((Segment.NumChannels <= 0) || (Segment.SampleRate <= 0))
+			continue;
+
+		int64 SegmentTimecode = Segment.OutputState.SourceTimeCode.ToTimespan(FrameRate).GetTicks();
+		int32 NumSamples = Segment.SegmentData.Num() / Segment.NumChannels;
+		int32 ChunkSamples = FMath::Max(FMath::RoundToInt(Segment.SampleRate * FrameRate.AsInterval()), 1);
+
+		for (int32 FirstSample = 0; FirstSample < NumSamples; FirstSample += ChunkSamples)
+		{
+			int64 Timecode = SegmentTimecode + (FirstSample * ETimespan::TicksPerSecond) / Segment.SampleRate;
+
+			this->Sender->SendAudioFrameFromCPU(Segment.SegmentData.GetData() + (int64)FirstSample * Segment.NumChannels,
+												FMath::Min(ChunkSamples, NumSamples - FirstSample), Segment.NumChannels,
+												Segment.SampleRate, FMath::Max<int64>(Timecode, 1));
+		}
+	}
+}
+
+#undef LOCTEXT_NAMESPACE
@@ -0,0 +1,55 @@
+/*
+	Copyright (C) 2023 Vizrt NDI AB. All rights reserved.
+
+	This file and it's use within a Product is bound by the terms of NDI SDK license that was provided
+	as part of the NDI SDK. For more information, please review the license and the NDI SDK documentation.
+*/
+
+using System;
+using System.IO;
+
+using UnrealBuildTool;
+
+public class NDIIOMoviePipeline : ModuleRules
+{
+	public NDIIOMoviePipeline(ReadOnlyTargetRules Target) : base(Target)
+	{
+#if UE_5_2_OR_LATER
+		IWYUSupport = IWYUSupport.Full;
+#else
+		bEnforceIWYU = true;
+#endif
+		PCHUsage = PCHUsageMode.UseExplicitOrSharedPCHs;
+
+		#region Public Includes
+
+		if (Directory.Exists(Path.Combine(ModuleDirectory, "Public")))
+		{
+			PublicIncludePaths.AddRange(new string[] {
+				// ... add public include paths required here ...
+				Path.Combine(ModuleDirectory, "Public" ),
+			});
+		}
+
+		PublicDependencyModuleNames.AddRange(new string[] {
+			"Engine",
+			"Core",
+			"CoreUObject",
+			"MovieRenderPipelineCore",
+			"NDIIO"
+		});
+
+		#endregion
+
+		#region Private Includes
+
+		PrivateDependencyModuleNames.AddRange(new string[] {
+			"ImageWriteQueue",
+			"LevelSequence",
+			"MovieScene",
+			"AudioMixer"
+		});
+
+		#endregion
+	}
+}
@@ -0,0 +1,94 @@
+/*
+	Copyright (C) 2023 Vizrt NDI AB. All rights reserved.
+
+	This file and it's use within a Product is bound by the terms of NDI SDK license that was provided
+	as part of the NDI SDK. For more information, please review the license and the NDI SDK documentation.
+*/
+
+#pragma once
+
+#include <CoreMinimal.h>
+
+#include <MoviePipelineOutputBase.h>
+#include <Objects/Media/NDIMediaSender.h>
+#include <Misc/FrameRate.h>
+
+#include "NDIMoviePipelineOutput.generated.h"
+
+/**
+	How the frames rendered by the Movie Render Queue are delivered over NDI
+*/
+UENUM(BlueprintType, META = (DisplayName = "NDI Movie Pipeline Playout"))
+enum class ENDIMoviePipelinePlayout : uint8
+{
+	/** Every frame is sent as soon as it is rendered, and the render waits until the NDI SDK has sent it. */
+	BackPressure = 0x00 UMETA(DisplayName = "Back-Pressure"),
+
+	/** Frames are sent no faster than the frame rate of the sequence, so that review plays in real time. */
+	RealTime = 0x01 UMETA(DisplayName = "Real-Time"),
+};
+
+/**
+	Sends the frames rendered by the Movie Render Queue, and their audio, over NDI, with the timecode of the
+	sequence, so that offline and slower than real time renders can be reviewed live over the network
+*/
+UCLASS(BlueprintType, META = (DisplayName = "NDI Output"))
+class NDIIOMOVIEPIPELINE_API UNDIMoviePipelineOutput : public UMoviePipelineOutputBase
+{
+	GENERATED_BODY()
+
+public:
+	/** The name of the source as seen on the network */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "NDI IO", META = (DisplayName = "Source Name"))
+	FString SourceName = FString("Unreal Engine Render");
+
+	/** How the rendered frames are delivered */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "NDI IO", META = (DisplayName = "Playout"))
+	ENDIMoviePipelinePlayout Playout = ENDIMoviePipelinePlayout::BackPressure;
+
+	/**
+		Waits for a receiver to connect before sending each frame, so that no frame is rendered without being
+		received. The render carries on without sending once the timeout (in seconds) has elapsed.
+	*/
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "NDI IO", META = (DisplayName = "Wait For Receiver"))
+	bool bWaitForReceiver = true;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "NDI IO",
+			  META = (DisplayName = "Receiver Timeout", ClampMin = 0.0, EditCondition = "bWaitForReceiver"))
+	float ReceiverTimeout = 10.f;
+
+	/** Sends the audio rendered by the Movie Render Queue, once each of its segments is complete */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "NDI IO", META = (DisplayName = "Send Audio"))
+	bool bSendAudio = true;
+
+protected:
+	virtual void SetupForPipelineImpl(UMoviePipeline* InPipeline) override;
+	virtual void TeardownForPipelineImpl(UMoviePipeline* InPipeline) override;
+
+	virtual void OnReceiveImageDataImpl(FMoviePipelineMergerOutputFrame* InMergedOutputFrame) override;
+	virtual void BeginFinalizeImpl() override;
+
+#if WITH_EDITOR
+	virtual FText GetDisplayText() const override;
+#endif
+
+private:
+	bool WaitForReceiver();
+	void WaitForPlayoutTime(int32 OutputFrameNumber);
+	void SendFinishedAudioSegments();
+
+private:
+	UPROPERTY(Transient)
+	UNDIMediaSender* Sender = nullptr;
+
+	FFrameRate FrameRate;
+	TArray<FColor> ConversionBuffer;
+	TSet<FGuid> SentAudioSegments;
+
+	/** The time at which the first frame was sent, for real-time playout */
+	uint64 PlayoutStartCycles = 0;
+	int32 PlayoutStartFrame = 0;
+	bool bHasStartedPlayout = false;
+
+	bool bHasReceiverTimedOut = false;
+};